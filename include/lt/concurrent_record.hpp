@@ -0,0 +1,172 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "lt/record_layout.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+
+namespace lt
+{
+//  concurrent_record< Entries... > shares a record with trivially copyable values between
+//  one writer and any number of readers (seqlock):
+//
+//  The record is kept in its binary_layout in an array of atomic words.  store( r )
+//  makes the sequence number odd, writes the words and makes it even again.  A reader
+//  copies the words and retries only if the sequence number was odd or has changed in
+//  between, i.e. readers never block the writer nor each other and only repeat the copy
+//  if it overlapped with a write.
+//
+//  snapshot() returns a consistent copy of the record.  load( index<"key"> ) reads a
+//  single value;  values that lie within one word of the layout are read with a single
+//  atomic load and need no retry.  store must not be called concurrently.
+
+    template<  typename... Entries  >
+    requires map_parameters< Entries... >
+    struct concurrent_record;
+
+
+
+    template<  typename...                        Key
+            ,  typename...                        Value
+            ,  template<  typename... > class...  Entry_t
+            >
+    requires
+        map_parameters<  Entry_t< Key, Value >...  >
+    struct alignas( 64 ) concurrent_record<  Entry_t< Key, Value >...  >
+    {
+    private:
+
+        using record_t  =  record<  Entry_t< Key, Value >...  >;
+        using layout_   =  binary_layout< record_t >;
+
+
+        static constexpr std::size_t  W  =  ( layout_::size + 7 ) / 8;
+
+
+        std::atomic< std::uint64_t >  sequence_{ 0 };
+        std::atomic< std::uint64_t >  words_[ W + 1 ];
+
+
+
+        void read_(  std::uint64_t*  words,  std::size_t  begin,  std::size_t  end  )  const  noexcept
+        {
+            for ( ;; )
+            {
+                std::uint64_t const s = sequence_.load( std::memory_order_acquire );
+
+                if ( s % 2 == 0 )
+                {
+                    for ( std::size_t k = begin;  k != end;  ++k )
+                        words[ k ] = words_[ k ].load( std::memory_order_relaxed );
+
+                    std::atomic_thread_fence( std::memory_order_acquire );
+
+                    if ( sequence_.load( std::memory_order_relaxed ) == s )
+                        return;
+                }
+            }
+        }
+
+
+
+    public:
+
+        concurrent_record()  noexcept
+        :   concurrent_record(  record_t{}  )
+        { }
+
+
+
+        explicit concurrent_record(  record_t const&  r  )  noexcept
+        {
+            std::uint64_t words[ W + 1 ] = {};
+
+            layout_::store(  r,  reinterpret_cast< std::byte* >( words )  );
+
+            for ( std::size_t k = 0;  k != W + 1;  ++k )
+                words_[ k ].store(  words[ k ],  std::memory_order_relaxed  );
+        }
+
+
+
+        concurrent_record(  concurrent_record const&  )  =  delete;
+        concurrent_record&  operator=(  concurrent_record const&  )  =  delete;
+
+
+
+        void store(  record_t const&  r  )  noexcept
+        {
+            std::uint64_t words[ W + 1 ] = {};
+
+            layout_::store(  r,  reinterpret_cast< std::byte* >( words )  );
+
+
+            std::uint64_t const s = sequence_.load( std::memory_order_relaxed );
+
+            sequence_.store(  s + 1,  std::memory_order_relaxed  );
+            std::atomic_thread_fence( std::memory_order_release );
+
+            for ( std::size_t k = 0;  k != W;  ++k )
+                words_[ k ].store(  words[ k ],  std::memory_order_relaxed  );
+
+            sequence_.store(  s + 2,  std::memory_order_release  );
+        }
+
+
+
+        record_t snapshot()  const  noexcept
+        {
+            std::uint64_t words[ W + 1 ] = {};
+
+            read_(  words,  0,  W  );
+
+            return record_view< record_t >{  std::span< std::byte const >(  reinterpret_cast< std::byte const* >( words ),  layout_::size  )  };
+        }
+
+
+
+        template<  typename K  >
+        auto load(  type_hull< K >  k  )  const  noexcept
+        {
+            if constexpr (  ! layout_::stored(  type_hull< K >{}  )  )
+            {
+                return layout_::load(  k,  nullptr  );
+            }
+            else
+            {
+                constexpr std::size_t  offset  =  layout_::offset(  type_hull< K >{}  );
+                constexpr std::size_t  size    =  sizeof(  layout_::load(  type_hull< K >{},  nullptr  )  );
+                constexpr std::size_t  begin   =  offset / 8;
+                constexpr std::size_t  end     =  ( offset + size + 7 ) / 8;
+
+                std::uint64_t words[ W + 1 ] = {};
+
+                if constexpr (  end - begin == 1  )
+                    words[ begin ] = words_[ begin ].load( std::memory_order_acquire );
+                else
+                    read_(  words,  begin,  end  );
+
+                return layout_::load(  k,  reinterpret_cast< std::byte const* >( words )  );
+            }
+        }
+
+
+
+        std::uint64_t version()  const  noexcept
+        {
+            return sequence_.load( std::memory_order_acquire ) / 2;
+        }
+    };
+}
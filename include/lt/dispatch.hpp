@@ -0,0 +1,263 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "lt/s_types.hpp"
+#include "lt/type_hull.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+
+
+namespace lt
+{
+//  Runtime dispatch over the result of a metaprogram:
+//
+//  dispatch_table< s< Xs... > > turns an evaluated list of types or values (e.g. the
+//  result of lt::eval or lt::metaprogram) into a constexpr array of function pointers.
+//  The alternative X is passed to the function object as type_hull< X > if X is a type
+//  and as v< x > if X is the value v< x >, i.e.
+//
+//      dispatch_table< L >::visit( i,  f,  args... )
+//
+//  calls f( type_hull< Xi >{}, args... ) (resp. f( v< xi >{}, args... )) with one
+//  indirect call;  all alternatives must have the same result type (static_assert).
+//  i < size.
+//
+//  For lists of integral values, index_of( key ) is the position of the value key or
+//  size;  it is an array lookup if the values are dense (max - min < 4 size + 16) and a
+//  binary search otherwise.  The values must be distinct (static_assert).  visit_key( key,  f,  args... ) is visit( index_of( key ), ... )
+//  and requires key to be one of the values (asserted, as i < size in visit).  For keys from
+//  the outside use visit_key_or( key,  f,  otherwise,  args... ),  which calls
+//  otherwise( args... ) if key is not one of the values.
+
+    template<  typename List  >
+    struct dispatch_table;
+
+
+
+    template<  typename... Xs  >
+    struct dispatch_table<  s< Xs... >  >
+    {
+        static constexpr std::size_t  size  =  sizeof...(Xs);
+
+
+    private:
+
+        template<  typename X  >
+        struct alternative_
+        {
+            using type  =  type_hull< X >;
+        };
+
+
+        template<  auto x  >
+        struct alternative_<  v< x >  >
+        {
+            using type  =  v< x >;
+        };
+
+
+
+        template<  typename X  >
+        using alternative  =  typename alternative_< X >::type;
+
+
+
+        template<  typename X,  typename R,  typename F,  typename... Args  >
+        static constexpr R thunk_(  F& f,  Args&&... args  )
+        {
+            return f(  alternative< X >{},  static_cast< Args&& >( args )...  );
+        }
+
+
+
+        template<  typename R,  typename F,  typename... Args  >
+        static constexpr R (* const table_[ size ] )(  F&,  Args&&...  )  =  {  &thunk_<  Xs,  R,  F,  Args...  >...  };
+
+
+
+        template<  typename X,  typename...  >
+        struct first_
+        {
+            using type  =  X;
+        };
+
+
+
+        template<  typename X  >
+        struct integral_
+        :   std::false_type
+        { };
+
+
+        template<  auto x  >
+        struct integral_<  v< x >  >
+        :   std::is_integral<  decltype( x )  >
+        { };
+
+
+
+        //  The values in ascending order with their positions:
+
+        struct keys_
+        {
+            long long    key[ size + 1 ]       =  {};
+            std::size_t  position[ size + 1 ]  =  {};
+            long long    min                   =  0;
+            long long    range                 =  0;
+            bool         distinct              =  true;
+        };
+
+
+
+        template<  auto... x  >
+        static consteval keys_ keys_of_(  v< x >...  )
+        {
+            keys_  k;
+
+            std::size_t n = 0;
+            (  (  k.key[ n ] = static_cast< long long >( x ),  k.position[ n ] = n,  ++n  ),  ...  );
+
+            for ( std::size_t i = 1;  i < size;  ++i )          //  insertion sort
+                for ( std::size_t j = i;  j != 0  &&  k.key[ j - 1 ] > k.key[ j ];  --j )
+                {
+                    long long    const  key       =  k.key[ j ];
+                    std::size_t  const  position  =  k.position[ j ];
+
+                    k.key[ j ]      =  k.key[ j - 1 ];     k.position[ j ]      =  k.position[ j - 1 ];
+                    k.key[ j - 1 ]  =  key;                k.position[ j - 1 ]  =  position;
+                }
+
+            for ( std::size_t i = 1;  i < size;  ++i )
+                if ( k.key[ i - 1 ] == k.key[ i ] )
+                    k.distinct = false;
+
+            k.min    =  k.key[ 0 ];
+            k.range  =  k.key[ size - 1 ] - k.key[ 0 ] + 1;
+
+            return k;
+        }
+
+
+
+        static constexpr keys_  keys_table_  =  keys_of_(  Xs{}...  );      //  (instantiated by index_of only)
+
+
+
+        template<  long long range  >
+        struct dense_
+        {
+            std::size_t  position[ range ]  =  {};
+        };
+
+
+
+        template<  long long range  >
+        static consteval dense_< range > dense_of_()
+        {
+            dense_< range >  d;
+
+            for ( auto& p : d.position )
+                p = size;
+
+            for ( std::size_t k = 0;  k != size;  ++k )
+                d.position[ keys_table_.key[ k ] - keys_table_.min ]  =  keys_table_.position[ k ];
+
+            return d;
+        }
+
+
+
+        template<  long long range  >
+        static constexpr dense_< range >  dense_table_  =  dense_of_< range >();
+
+
+
+    public:
+
+        template<  typename F,  typename... Args  >
+        requires (  size != 0  )
+        static constexpr decltype(auto)  visit(  std::size_t  i,  F&&  f,  Args&&... args  )
+        {
+            using R  =  decltype(  f(  alternative<  typename first_< Xs... >::type  >{},  static_cast< Args&& >( args )...  )  );
+
+            static_assert(  (  std::is_same_v<  R,  decltype(  f(  alternative< Xs >{},  static_cast< Args&& >( args )...  )  )  >  &&  ...  )
+                         ,  "dispatch_table: all alternatives must have the same result type"
+                         );
+
+            assert(  i < size  );
+
+            return table_<  R,  std::remove_reference_t< F >,  Args...  >[ i ](  f,  static_cast< Args&& >( args )...  );
+        }
+
+
+
+        template<  typename Key  >
+        requires (  size != 0  &&  std::is_integral_v< Key >  &&  (  integral_< Xs >::value  &&  ...  )  )
+        static constexpr std::size_t index_of(  Key  key  )  noexcept
+        {
+            constexpr keys_ const&  k  =  keys_table_;
+
+            static_assert(  k.distinct,  "dispatch_table: the values must be distinct"  );
+
+            long long const  x  =  static_cast< long long >( key );
+
+            if constexpr (  k.range <= static_cast< long long >( 4 * size + 16 )  )
+            {
+                return  x < k.min  ||  x - k.min >= k.range
+                        ?  size
+                        :  dense_table_< k.range >.position[ x - k.min ];
+            }
+            else
+            {
+                std::size_t  lo  =  0;
+                std::size_t  hi  =  size;
+
+                while ( lo != hi )
+                {
+                    std::size_t const mid = lo + ( hi - lo ) / 2;
+
+                    if ( k.key[ mid ] < x )
+                        lo = mid + 1;
+                    else
+                        hi = mid;
+                }
+
+                return  lo != size  &&  k.key[ lo ] == x  ?  k.position[ lo ]  :  size;
+            }
+        }
+
+
+
+        template<  typename Key,  typename F,  typename... Args  >
+        requires (  size != 0  &&  std::is_integral_v< Key >  &&  (  integral_< Xs >::value  &&  ...  )  )
+        static constexpr decltype(auto)  visit_key(  Key  key,  F&&  f,  Args&&... args  )
+        {
+            return visit(  index_of( key ),  static_cast< F&& >( f ),  static_cast< Args&& >( args )...  );
+        }
+
+
+
+        template<  typename Key,  typename F,  typename Otherwise,  typename... Args  >
+        requires (  size != 0  &&  std::is_integral_v< Key >  &&  (  integral_< Xs >::value  &&  ...  )  )
+        static constexpr decltype(auto)  visit_key_or(  Key  key,  F&&  f,  Otherwise&&  otherwise,  Args&&... args  )
+        {
+            std::size_t const  i  =  index_of( key );
+
+            if ( i == size )
+                return otherwise(  static_cast< Args&& >( args )...  );
+
+            return visit(  i,  static_cast< F&& >( f ),  static_cast< Args&& >( args )...  );
+        }
+    };
+}
@@ -13,6 +13,14 @@
 #include "map.hpp"
 #include "type_hull.hpp"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 
 
 namespace lt
@@ -122,6 +130,41 @@ private:
 
 
 
+//  error_< Kind, Operand... >:
+//
+//  The error raised by a keyword or an operation:  Kind names what failed (the keyword,
+//  the operator, a message),  Operand... are the offending arguments.  By default an error
+//  is just  eval_error< Kind >,  and an error inside an argument is propagated as it is,
+//  instead of being wrapped into the surrounding call  (first_error_< Xs... > is the first
+//  error among the arguments Xs...).  Errors therefore stay small, and code that probes
+//  for failure with if_possible or eval_success does not build types of the size of the
+//  program.  Define TRIVIUM_FULL_EVAL_ERRORS to keep the operands and the enclosing
+//  expressions for show_error and compiler diagnostics.
+
+#ifdef TRIVIUM_FULL_EVAL_ERRORS
+    template<  typename Kind,  typename... Operand  >
+    using error_ = eval_error<  Kind,  Operand...  >;
+#else
+    template<  typename Kind,  typename...  >
+    using error_ = eval_error<  Kind  >;
+
+
+
+    template<  typename X,  typename... Xs  >
+    struct first_error_
+    :   first_error_<  Xs...  >
+    { };
+
+
+
+    template<  typename... p,  typename... Xs  >
+    struct first_error_<  eval_error< p... >,  Xs...  >
+    :   eval_error<  p...  >
+    { };
+#endif
+
+
+
 //  gather:
 //
 //  Intantiate a class template F with parameters Xs... whenever
@@ -130,14 +173,31 @@ private:
 //  If the instantation is not possible, or if (at least) one ofr the
 //  parameters Xs... is an instance of eval_error, then return the
 //  type
-//          eval_error< class_template<f>, Xs... >.
+//          error_< class_template<f>, Xs... >,
+//
+//  respectively the first erratic parameter without TRIVIUM_FULL_EVAL_ERRORS.
 
     template<  template<  typename...  > class F
             ,  typename...                     Xs
             >
     struct gather
-    :   eval_error<  class_template<F>,  Xs...  >
+    :   error_<  class_template<F>,  Xs...  >
+    { };
+
+
+
+#ifndef TRIVIUM_FULL_EVAL_ERRORS
+    template<  template<  typename...  > class   F
+            ,  typename...                       Xs
+            >
+    requires
+    (
+        (  no_eval_error<Xs>{} == t_false{}  )  ||  ...
+    )
+    struct gather<  F,  Xs... >
+    :   first_error_<  Xs...  >
     { };
+#endif
 
 
 
@@ -231,6 +291,7 @@ private:
 
     using  apply_t         =  value_type<"apply"_text>;
     using  and_t           =  value_type<"and"_text>;
+    using  bit_not_t       =  value_type<"~"_text>;
     using  cons_t          =  value_type<"cons"_text>;
     using  count_t         =  value_type<"count"_text>;
     using  def_t           =  value_type<"def"_text>;
@@ -240,17 +301,26 @@ private:
     using  eq_t            =  value_type<"eq"_text>;
     using  export_t        =  value_type<"export"_text>;
     using  first_t         =  value_type<"first"_text>;
+    using  fold_t          =  value_type<"fold"_text>;
     using  if_t            =  value_type<"if"_text>;
     using  if_possible_t   =  value_type<"if_possible"_text>;
     using  import_t        =  value_type<"import"_text>;
     using  is_atom_t       =  value_type<"is_atom"_text>;
     using  is_integral_t   =  value_type<"is_integral"_text>;
+    using  match_t         =  value_type<"match"_text>;
     using  not_t           =  value_type<"not"_text>;
     using  or_t            =  value_type<"or"_text>;
+    using  pack_t          =  value_type<"pack"_text>;
     using  raise_error_t   =  value_type<"raise_error"_text>;
     using  rcons_t         =  value_type<"rcons"_text>;
     using  requires_t      =  value_type<"requires"_text>;
     using  show_error_t    =  value_type<"show_error"_text>;
+    using  text_concat_t   =  value_type<"text_concat"_text>;
+    using  text_hash_t     =  value_type<"text_hash"_text>;
+    using  text_length_t   =  value_type<"text_length"_text>;
+    using  text_less_t     =  value_type<"text_<"_text>;
+    using  text_substr_t   =  value_type<"text_substr"_text>;
+    using  unpack_t        =  value_type<"unpack"_text>;
     using  xor_t           =  value_type<"xor"_text>;
 
 
@@ -275,8 +345,21 @@ private:
 
     template<  typename Op,  typename X,  typename Y  >
     struct bin_op
-    :   eval_error<  Op,  X,  Y  >
+    :   error_<  Op,  X,  Y  >
+    { };
+
+
+
+#ifndef TRIVIUM_FULL_EVAL_ERRORS
+    template<  typename Op,  typename X,  typename Y  >
+    requires
+    (
+        no_eval_error<X>{} == t_false{}  ||  no_eval_error<Y>{} == t_false{}
+    )
+    struct bin_op<  Op,  X,  Y  >
+    :   first_error_<  X,  Y  >
     { };
+#endif
 
 
 //  ==,  !=,  <=,  >=,  <,  >:
@@ -384,6 +467,100 @@ private:
 
 
 //  +,  -,  *,  /,  %:
+//
+//  Integer arithmetic is overflow-checked:  + - * fail,  if the mathematical result is
+//  not representable in the type of the C++ result (for unsigned types,  too).  The
+//  variants wrap_+ wrap_- wrap_* compute modulo 2^n in that type.
+
+    struct exact_integer_
+    {
+        bool                minus;
+        unsigned long long  x;              // absolute value
+    };
+
+
+
+    template<  auto x  >
+    static consteval exact_integer_ exact_integer_of_()
+    {
+        if constexpr (  std::is_signed_v<  decltype( x )  >  )
+        {
+            if ( x < 0 )
+                return {  true,  0ull - static_cast< unsigned long long >( x )  };
+        }
+
+        return {  false,  static_cast< unsigned long long >( x )  };
+    }
+
+
+
+    template<  typename R  >
+    static consteval bool exact_fits_(  exact_integer_  r  )
+    {
+        constexpr auto  max  =  static_cast< unsigned long long >(  std::numeric_limits< R >::max()  );
+
+        if ( r.x == 0 )
+            return true;
+
+        return  r.minus  ?  std::is_signed_v< R >  &&  r.x - 1 <= max
+                         :  r.x <= max;
+    }
+
+
+
+    template<  char op,  auto x,  auto y  >
+    static consteval bool exact_()
+    {
+        if constexpr (  ! std::is_integral_v<  decltype( x )  >  ||  ! std::is_integral_v<  decltype( y )  >  )
+        {
+            return true;
+        }
+        else
+        {
+            exact_integer_        a  =  exact_integer_of_< x >();
+            exact_integer_        b  =  exact_integer_of_< y >();
+            exact_integer_        r  {  a.minus != b.minus,  a.x * b.x  };
+
+            if ( op == '*' )
+                return  (  a.x == 0  ||  r.x / a.x == b.x  )  &&  exact_fits_<  decltype( x * y )  >( r );
+
+            if ( op == '-' )
+                b.minus = ! b.minus;
+
+            if ( a.minus == b.minus )
+            {
+                r = {  a.minus,  a.x + b.x  };
+
+                if ( r.x < a.x )
+                    return false;
+            }
+            else
+            {
+                r  =  a.x >= b.x  ?  exact_integer_{  a.minus,  a.x - b.x  }
+                                  :  exact_integer_{  b.minus,  b.x - a.x  };
+            }
+
+            return exact_fits_<  decltype( x + y )  >( r );
+        }
+    }
+
+
+
+    template<  char op,  auto x,  auto y  >
+    static consteval auto wrap_()
+    {
+        using R  =  decltype( x + y );
+        using U  =  std::make_unsigned_t< R >;
+
+        U const  a  =  static_cast< U >( x );
+        U const  b  =  static_cast< U >( y );
+
+        return static_cast< R >(  op == '+'  ?  U( a + b )
+                               :  op == '-'  ?  U( a - b )
+                               :               U( a * b )
+                               );
+    }
+
 
     template<  auto  x
             ,  auto  y
@@ -393,6 +570,7 @@ private:
     {
         nullptr;
     }
+    &&  (  exact_< '+',  x,  y  >()  )
     struct bin_op<  text<'+'>
                  ,  value< x >
                  ,  value< y >
@@ -410,6 +588,7 @@ private:
     {
         nullptr;
     }
+    &&  (  exact_< '-',  x,  y  >()  )
     struct bin_op<  text<'-'>
                  ,  value< x >
                  ,  value< y >
@@ -427,6 +606,7 @@ private:
     {
         nullptr;
     }
+    &&  (  exact_< '*',  x,  y  >()  )
     struct bin_op<  text<'*'>
                  ,  value< x >
                  ,  value< y >
@@ -470,6 +650,141 @@ private:
 
 
 
+    template<  auto  x
+            ,  auto  y
+            >
+    requires
+    (
+        std::is_integral_v<  decltype( x )  >  &&  std::is_integral_v<  decltype( y )  >
+    )
+    struct bin_op<  text<'w','r','a','p','_','+'>
+                 ,  value< x >
+                 ,  value< y >
+                 >
+    :   eval_result<  value<  wrap_< '+',  x,  y  >()  >  >
+    { };
+
+
+
+    template<  auto  x
+            ,  auto  y
+            >
+    requires
+    (
+        std::is_integral_v<  decltype( x )  >  &&  std::is_integral_v<  decltype( y )  >
+    )
+    struct bin_op<  text<'w','r','a','p','_','-'>
+                 ,  value< x >
+                 ,  value< y >
+                 >
+    :   eval_result<  value<  wrap_< '-',  x,  y  >()  >  >
+    { };
+
+
+
+    template<  auto  x
+            ,  auto  y
+            >
+    requires
+    (
+        std::is_integral_v<  decltype( x )  >  &&  std::is_integral_v<  decltype( y )  >
+    )
+    struct bin_op<  text<'w','r','a','p','_','*'>
+                 ,  value< x >
+                 ,  value< y >
+                 >
+    :   eval_result<  value<  wrap_< '*',  x,  y  >()  >  >
+    { };
+
+
+
+//  &,  |,  ^,  <<,  >>:
+
+    template<  auto  x
+            ,  auto  y
+            >
+    requires
+    requires(  value<  ( x & y )  >  )
+    {
+        nullptr;
+    }
+    struct bin_op<  text<'&'>
+                 ,  value< x >
+                 ,  value< y >
+                 >
+    :   eval_result<  value<  ( x & y )  >  >
+    { };
+
+
+
+    template<  auto  x
+            ,  auto  y
+            >
+    requires
+    requires(  value<  ( x | y )  >  )
+    {
+        nullptr;
+    }
+    struct bin_op<  text<'|'>
+                 ,  value< x >
+                 ,  value< y >
+                 >
+    :   eval_result<  value<  ( x | y )  >  >
+    { };
+
+
+
+    template<  auto  x
+            ,  auto  y
+            >
+    requires
+    requires(  value<  ( x ^ y )  >  )
+    {
+        nullptr;
+    }
+    struct bin_op<  text<'^'>
+                 ,  value< x >
+                 ,  value< y >
+                 >
+    :   eval_result<  value<  ( x ^ y )  >  >
+    { };
+
+
+
+    template<  auto  x
+            ,  auto  y
+            >
+    requires
+    requires(  value<  ( x << y )  >  )
+    {
+        nullptr;
+    }
+    struct bin_op<  text<'<','<'>
+                 ,  value< x >
+                 ,  value< y >
+                 >
+    :   eval_result<  value<  ( x << y )  >  >
+    { };
+
+
+
+    template<  auto  x
+            ,  auto  y
+            >
+    requires
+    requires(  value<  ( x >> y )  >  )
+    {
+        nullptr;
+    }
+    struct bin_op<  text<'>','>'>
+                 ,  value< x >
+                 ,  value< y >
+                 >
+    :   eval_result<  value<  ( x >> y )  >  >
+    { };
+
+
+
 // -----------------------------------------------------------------------------
 //
 //  Expressions
@@ -521,7 +836,11 @@ private:
                 ,  Lut
                 ,  s<  eval_error<p...>,  q...  >
                 >
+#ifdef TRIVIUM_FULL_EVAL_ERRORS
     :   eval_result<  eval_error< eval_error<p...>, q... >  >
+#else
+    :   eval_result<  eval_error<p...>  >
+#endif
     { };
 
 
@@ -960,6 +1279,18 @@ private:
 
 
 
+    template<  eval_mode mode
+            ,  typename  Lut
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  fold_t
+                >
+    :   eval_result<  call<  1,  fold_t  >  >
+    { };
+
+
+
     template<  eval_mode mode
             ,  typename  Lut
             >
@@ -1020,6 +1351,18 @@ private:
 
 
 
+    template<  eval_mode mode
+            ,  typename  Lut
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  match_t
+                >
+    :   eval_result<  call<  1,  match_t  >  >
+    { };
+
+
+
     template<  eval_mode  mode
             ,  typename   Lut
             >
@@ -1032,6 +1375,30 @@ private:
 
 
 
+    template<  eval_mode  mode
+            ,  typename   Lut
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  bit_not_t
+                >
+    :   eval_result<  call<  1,  bit_not_t  >  >
+    { };
+
+
+
+    template<  eval_mode mode
+            ,  typename  Lut
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  pack_t
+                >
+    :   eval_result<  call<  1,  pack_t  >  >
+    { };
+
+
+
     template<  eval_mode mode
             ,  typename  Lut
             >
@@ -1094,22 +1461,94 @@ private:
 
 
 
-// -----------------------------------------------------------------------------
-//  <=  >=  <  >  == !=  +  -  *  /  %:
-// -----------------------------------------------------------------------------
+    template<  eval_mode mode
+            ,  typename  Lut
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  text_concat_t
+                >
+    :   eval_result<  call<  1,  text_concat_t  >  >
+    { };
 
 
 
-//  Processing of operator names and first argument
+    template<  eval_mode mode
+            ,  typename  Lut
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  text_hash_t
+                >
+    :   eval_result<  call<  1,  text_hash_t  >  >
+    { };
 
 
-    template<  eval_mode    mode
-            ,  typename     Lut
-            ,  char...      f
+
+    template<  eval_mode mode
+            ,  typename  Lut
             >
-    requires
-    (
-        text< f... >{} == "<="_text ||
+    struct eval_<  mode
+                ,  Lut
+                ,  text_length_t
+                >
+    :   eval_result<  call<  1,  text_length_t  >  >
+    { };
+
+
+
+    template<  eval_mode mode
+            ,  typename  Lut
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  text_less_t
+                >
+    :   eval_result<  call<  1,  text_less_t  >  >
+    { };
+
+
+
+    template<  eval_mode mode
+            ,  typename  Lut
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  text_substr_t
+                >
+    :   eval_result<  call<  1,  text_substr_t  >  >
+    { };
+
+
+
+    template<  eval_mode mode
+            ,  typename  Lut
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  unpack_t
+                >
+    :   eval_result<  call<  1,  unpack_t  >  >
+    { };
+
+
+
+// -----------------------------------------------------------------------------
+//  <=  >=  <  >  == !=  +  -  *  /  %:
+// -----------------------------------------------------------------------------
+
+
+
+//  Processing of operator names and first argument
+
+
+    template<  eval_mode    mode
+            ,  typename     Lut
+            ,  char...      f
+            >
+    requires
+    (
+        text< f... >{} == "<="_text ||
         text< f... >{} == "!="_text ||
         text< f... >{} == "=="_text ||
         text< f... >{} == ">="_text ||
@@ -1119,7 +1558,15 @@ private:
         text< f... >{} == "-"_text  ||
         text< f... >{} == "*"_text  ||
         text< f... >{} == "/"_text  ||
-        text< f... >{} == "%"_text
+        text< f... >{} == "%"_text  ||
+        text< f... >{} == "wrap_+"_text  ||
+        text< f... >{} == "wrap_-"_text  ||
+        text< f... >{} == "wrap_*"_text  ||
+        text< f... >{} == "&"_text  ||
+        text< f... >{} == "|"_text  ||
+        text< f... >{} == "^"_text  ||
+        text< f... >{} == "<<"_text ||
+        text< f... >{} == ">>"_text
     )
     struct eval_<  mode
                 ,  Lut
@@ -1148,7 +1595,15 @@ private:
         text< f... >{} == "-"_text  ||
         text< f... >{} == "*"_text  ||
         text< f... >{} == "/"_text  ||
-        text< f... >{} == "%"_text
+        text< f... >{} == "%"_text  ||
+        text< f... >{} == "wrap_+"_text  ||
+        text< f... >{} == "wrap_-"_text  ||
+        text< f... >{} == "wrap_*"_text  ||
+        text< f... >{} == "&"_text  ||
+        text< f... >{} == "|"_text  ||
+        text< f... >{} == "^"_text  ||
+        text< f... >{} == "<<"_text ||
+        text< f... >{} == ">>"_text
     )
     struct eval_<  mode
                 ,  Lut
@@ -1176,7 +1631,15 @@ private:
         text< f... >{} == "-"_text  ||
         text< f... >{} == "*"_text  ||
         text< f... >{} == "/"_text  ||
-        text< f... >{} == "%"_text
+        text< f... >{} == "%"_text  ||
+        text< f... >{} == "wrap_+"_text  ||
+        text< f... >{} == "wrap_-"_text  ||
+        text< f... >{} == "wrap_*"_text  ||
+        text< f... >{} == "&"_text  ||
+        text< f... >{} == "|"_text  ||
+        text< f... >{} == "^"_text  ||
+        text< f... >{} == "<<"_text ||
+        text< f... >{} == ">>"_text
     )
     struct eval_<  mode
                 ,  Lut
@@ -1206,7 +1669,15 @@ private:
         text< f... >{} == "-"_text  ||
         text< f... >{} == "*"_text  ||
         text< f... >{} == "/"_text  ||
-        text< f... >{} == "%"_text
+        text< f... >{} == "%"_text  ||
+        text< f... >{} == "wrap_+"_text  ||
+        text< f... >{} == "wrap_-"_text  ||
+        text< f... >{} == "wrap_*"_text  ||
+        text< f... >{} == "&"_text  ||
+        text< f... >{} == "|"_text  ||
+        text< f... >{} == "^"_text  ||
+        text< f... >{} == "<<"_text ||
+        text< f... >{} == ">>"_text
     )
     struct eval_<  mode
                 ,  Lut
@@ -1245,6 +1716,59 @@ private:
 
 
 
+//  Tracing calls of definitions:
+//
+//  With TRIVIUM_TRACE_DEFS,  an application ( f args... ) of a name f that is bound in the
+//  lookup table is evaluated inside of
+//
+//      traced_def< text< f... > >::evaluation< mode, Lut, Expr >
+//
+//  Compiled with clang -ftime-trace -ftime-trace-granularity=0,  the instantiation of this
+//  marker is an event that spans the evaluation of the call and that is named by the
+//  definition.  src/tools/trivium-profile folds these events into a flat profile per
+//  definition.  The call depth follows from the nesting of the events, hence it is not a
+//  parameter of the marker:  calls at different depths still share one instantiation.
+//  Recursive calls of a definition go through the Y-combinator, not through its name, and
+//  are accounted to the outermost call.
+
+#ifdef TRIVIUM_TRACE_DEFS
+    struct unbound_ {};
+
+
+
+    template<  typename F  >
+    struct traced_def
+    {
+        template<  eval_mode  mode,  typename Lut,  typename Expr  >
+        struct evaluation
+        :   eval_<  mode,  Lut,  Expr  >
+        { };
+    };
+
+
+
+    template<  eval_mode    mode
+            ,  typename     Lut
+            ,  char...      f
+            ,  typename...  args
+            >
+    requires
+    (
+        ! std::is_same_v<  typename Lut::template lookup<  text< f... >,  unbound_  >,  unbound_  >
+    )
+    struct eval_<  mode
+                ,  Lut
+                ,  s<  text< f... >,  args... >
+                >
+    :   traced_def<  text< f... >  >::template evaluation<  mode
+                                                         ,  Lut
+                                                         ,  s<  eager_eval<  Lut,  text< f... >  >,  args...  >
+                                                         >
+    { };
+#endif
+
+
+
 // collection of a function argument:
 
     template<  eval_mode    mode
@@ -1312,7 +1836,11 @@ private:
                 ,  Lut
                 ,  s<  call<  k,  p...  >,  eval_error< q... >,  qs...  >
                 >
+#ifdef TRIVIUM_FULL_EVAL_ERRORS
     :   eval_error<  call<  k-1,  p...,  eval_error<  q...  >  >,  qs...  >
+#else
+    :   eval_error<  q...  >
+#endif
     { };
 
 
@@ -1349,7 +1877,7 @@ private:
                 ,  Lut
                 ,  s<  call< 0, list<n>, p... >,  q,  qs...  >
                 >
-    :   eval_error<  call< 0, list<n>, p... >,  q,  qs...  >
+    :   error_<  call< 0, list<n>, p... >,  q,  qs...  >
     {
         static_assert( sizeof...(p) == n,  "Internal interpreter error! " );
         static_assert( n != 0,  "Internal interpreter error!" );
@@ -1542,7 +2070,7 @@ private:
 
     template<  typename F  >
     struct def_lhs
-    :   eval_error<  value_type<"unusable left-hand side in def: "_text>,  F  >
+    :   error_<  value_type<"unusable left-hand side in def: "_text>,  F  >
     { };
 
 
@@ -1607,358 +2135,2185 @@ private:
 
 
 
-// -----------------------------------------------------------------------------
-//  unevaluated lists:
-// -----------------------------------------------------------------------------
-
-
-    template<  typename...  > struct lazy { };
-
+//  ----------------------------------------------------------------------------
+//  Pure integer definitions:
+//  ----------------------------------------------------------------------------
+//
+//  A definition ( def 'f [x...] body ) is pure, if the combinator term of [x...] body
+//  consists of S, K, int and bool values, f itself and the builtins
+//
+//      +  -  *  /  %  ==  !=  <  >  <=  >=  and  or  xor  not  if  eq
+//
+//  f is then bound to pure_function< f, term > instead of the Y-combinator expression.
+//  A call of a pure function with int or bool arguments is evaluated by pure_machine_,
+//  a consteval graph reducer over a flat array of nodes (the term is flattened once per
+//  call into the node array, f unfolds to a fresh copy of the term).  The result comes
+//  back as value< n >;  a partial application yields pure_function< f, term, args... >.
+//  Whenever the reducer fails (arguments or results that are no int or bool values,
+//  overflow, division by zero, ...), the call is evaluated with the Y-combinator as
+//  before, i.e. the results and errors are those of the general evaluation.
+//
+//  The reducer gives up after TRIVIUM_CONSTEVAL_DEF_STEPS steps, before the constexpr
+//  evaluation limits of the compiler are reached (raise both together, e.g. with
+//  -fconstexpr-steps).  Define TRIVIUM_NO_CONSTEVAL_DEF to evaluate all definitions
+//  with the Y-combinator.
 
+#ifndef TRIVIUM_CONSTEVAL_DEF_STEPS
+#define TRIVIUM_CONSTEVAL_DEF_STEPS  4000
+#endif
 
-    template<  typename     Lut
-            ,  typename...  p
-            >
-    struct eval_<  eval_mode::eager
-                ,  Lut
-                ,  lazy< p... >
-                >
-    :   gather< s,  eager_eval< Lut, p >...  >
-    { };
 
+    template<  typename F,  typename Term,  typename... Args  >
+    struct pure_function {};
 
 
-    template<  typename     Lut
-            ,  typename...  p
-            >
-    struct eval_<  eval_mode::lazy
-                ,  Lut
-                ,  lazy< p... >
-                >
-    :   eval_result<  lazy< p... >  >
-    { };
 
+    struct pure_node_
+    {
+        enum kind_t {  app,  s,  k,  b_,  c_,  i_,  integer,  boolean,  builtin,  self,  indirection  };
 
+        kind_t     kind;
+        int        a      =  0;       // app:  function,  indirection:  target,  builtin:  operator
+        int        b      =  0;       // app:  argument
+        long long  x      =  0;       // integer,  boolean
+    };
 
-// -----------------------------------------------------------------------------
-//  list<n>:
-// -----------------------------------------------------------------------------
 
 
-    template<  typename     Lut
-            ,  unsigned     n
-            ,  typename...  p
-            >
-    requires
-    (
-        n != 0  &&  sizeof...(p) == n
-    )
-    struct eval_<  eval_mode::eager
-                ,  Lut
-                ,  call< 0,  list<n>,  p...  >
-                >
-    :   gather< s,  eager_eval< Lut, p >...  >
+    struct pure_result_
     {
-        static_assert(  sizeof...(p) == n,  "Internal interpreter errror!"  );
+        enum status_t {  failure,  integer,  boolean,  function  };
+
+        status_t   status;
+        long long  x       =  0;
     };
 
 
 
-    template<  typename     Lut
-            ,  unsigned     n
-            ,  typename...  p
-            >
-    requires
-    (
-        n != 0  &&  sizeof...(p) == n
-    )
-    struct eval_<  eval_mode::lazy
-                ,  Lut
-                ,  call< 0,  list<n>,  p...  >
-                >
-    :   gather<  lazy,  p...  >
+    struct pure_machine_
     {
-        static_assert(  sizeof...(p) == n,  "Internal interpreter errror!"  );
-    };
+        enum builtin_t {  add,  sub,  mul,  div,  mod,  equal,  unequal,  less,  greater,  less_equal,  greater_equal
+                       ,  and_,  or_,  xor_,  not_,  if_,  eq_
+                       };
 
 
+        std::vector< pure_node_ >  term;          //  the flattened term,  term.back() is its root
+        std::vector< pure_node_ >  heap;
 
-//  ----------------------------------------------------------------------------
-//  first:
-//  ----------------------------------------------------------------------------
 
+        static consteval int arity_(  int  op  )
+        {
+            return  op == not_  ||  op == if_  ?  1  :  2;
+        }
 
-    template<  eval_mode,  typename,  typename X  >
-    struct First
-    :   eval_error<  first_t,  X  >
-    { };
 
 
+        consteval int make_(  pure_node_  n  )
+        {
+            heap.push_back( n );
+            return static_cast< int >(  heap.size() - 1  );
+        }
 
-    template<  eval_mode    mode
-            ,  typename     Lut
-            ,  typename     X
-            ,  typename...  Xs
-            >
-    struct First<  mode,  Lut,  s<  X,  Xs... >  >
-    :   eval_result< X  >
-    { };
 
 
+        consteval int instance_()              //  copy of the term in the heap
+        {
+            int const  offset  =  static_cast< int >(  heap.size()  );
 
-    template<  eval_mode    mode
-            ,  typename     Lut
-            ,  typename     p
-            ,  typename...  ps
-            >
-    struct First<  mode,  Lut,  lazy<  p,  ps... >  >
-    :   eval_< mode,  Lut,  p  >
-    { };
+            for ( pure_node_ n : term )
+            {
+                if ( n.kind == pure_node_::app )
+                {
+                    n.a += offset;
+                    n.b += offset;
+                }
 
+                heap.push_back( n );
+            }
 
+            return static_cast< int >(  heap.size() - 1  );
+        }
 
-    template<  eval_mode  mode
-            ,  typename   Lut
-            ,  typename   p
-            >
-    struct eval_<  mode
-                ,  Lut
-                ,  call<  0,  first_t,  p  >
-                >
-    :   First<  mode,  Lut,  lazy_eval< Lut, p >  >
-    { };
 
 
+        consteval int follow_(  int  n  )  const
+        {
+            while ( heap[ n ].kind == pure_node_::indirection )
+                n = heap[ n ].a;
 
-//  ----------------------------------------------------------------------------
-//  drop_first:
-//  ----------------------------------------------------------------------------
+            return n;
+        }
 
 
-    template<  eval_mode,  typename,  typename  >
-    struct Drop_First;
 
+        //  The value of a builtin with values as arguments,  an indirection for if:
 
+        consteval bool builtin_(  int  op,  pure_node_  p,  pure_node_  q,  pure_node_&  r  )
+        {
+            bool const  bools  =  p.kind == pure_node_::boolean  &&  q.kind == pure_node_::boolean;
 
-    template<  typename     Lut
-            ,  typename     p
-            ,  typename...  ps
-            >
-    struct Drop_First<  eval_mode::lazy
-                     ,  Lut
-                     ,  lazy<  p,  ps...  >
-                     >
-    :   eval_result<  lazy< ps... >  >
-    { };
+            long long  x  =  0;
 
+            switch ( op )
+            {
+            case add:  x = p.x + q.x;   break;
+            case sub:  x = p.x - q.x;   break;
+            case mul:  x = p.x * q.x;   break;
+
+            case div:
+            case mod:
+                if ( q.x == 0 )
+                    return false;
+
+                x  =  op == div  ?  p.x / q.x  :  p.x % q.x;
+                break;
+
+            case equal:          r = {  pure_node_::boolean,  0,  0,  p.x == q.x  };   return true;
+            case unequal:        r = {  pure_node_::boolean,  0,  0,  p.x != q.x  };   return true;
+            case less:           r = {  pure_node_::boolean,  0,  0,  p.x <  q.x  };   return true;
+            case greater:        r = {  pure_node_::boolean,  0,  0,  p.x >  q.x  };   return true;
+            case less_equal:     r = {  pure_node_::boolean,  0,  0,  p.x <= q.x  };   return true;
+            case greater_equal:  r = {  pure_node_::boolean,  0,  0,  p.x >= q.x  };   return true;
+
+            case eq_:
+                r = {  pure_node_::boolean,  0,  0,  p.kind == q.kind  &&  p.x == q.x  };
+                return true;
+
+            case and_:   r = {  pure_node_::boolean,  0,  0,  p.x && q.x  };          return bools;
+            case or_:    r = {  pure_node_::boolean,  0,  0,  p.x || q.x  };          return bools;
+            case xor_:   r = {  pure_node_::boolean,  0,  0,  p.x != q.x  };          return bools;
+            case not_:   r = {  pure_node_::boolean,  0,  0,  ! p.x  };               return p.kind == pure_node_::boolean;
+
+            case if_:                                 //  ( if true ) = K,  ( if false ) = K I
+                if ( p.kind != pure_node_::boolean )
+                    return false;
+
+                if ( p.x )
+                    r = {  pure_node_::k  };
+                else
+                    r = {  pure_node_::app,  make_( {  pure_node_::k  } ),  make_( {  pure_node_::i_  } )  };
+                return true;
+            }
 
+            if ( x < -2147483647ll - 1  ||  x > 2147483647ll )      //  as bin_op:  no overflow of int
+                return false;
 
-    template<  typename     Lut
-            ,  typename     p
-            ,  typename...  ps
-            >
-    struct Drop_First<  eval_mode::eager
-                     ,  Lut
-                     ,  lazy<  p,  ps...  >
-                     >
-    :  gather<  s,  eager_eval< Lut, ps >...  >
-    { };
+            r = {  pure_node_::integer,  0,  0,  x  };
+            return true;
+        }
 
 
 
-    template<  eval_mode    mode
-            ,  typename     Lut
-            ,  typename     p
-            ,  typename...  ps
-            >
-    struct Drop_First<  mode
-                     ,  Lut
-                     ,  s<  p,  ps...  >
-                     >
-    :   eval_result<  s<  ps...  >  >
-    { };
+        //  Normal order reduction of the heap node root to weak head normal form:  spine
+        //  holds the application nodes from root to the head,  dump the bases of the
+        //  spines of the builtin arguments that are being reduced.
 
+        consteval pure_result_ run(  int  root  )
+        {
+            std::vector< int >          spine{  root  };
+            std::vector< std::size_t >  dump;
 
+            for ( long  fuel  =  TRIVIUM_CONSTEVAL_DEF_STEPS;  ;  --fuel )
+            {
+                if ( fuel == 0 )
+                    return {  pure_result_::failure  };
+
+                int const  n  =  follow_(  spine.back()  );
+                spine.back()  =  n;
+
+                std::size_t const  base  =  dump.empty()  ?  0  :  dump.back();
+                std::size_t const  args  =  spine.size() - 1 - base;
+
+                auto const  redex  =  [ & ](  std::size_t k  ) {  return spine[ spine.size() - 1 - k ];  };
+                auto const  arg    =  [ & ](  std::size_t k  ) {  return heap[  spine[ spine.size() - 2 - k ]  ].b;  };
+
+                bool  normal  =  false;
+
+                switch (  heap[ n ].kind  )
+                {
+                case pure_node_::app:
+                    spine.push_back(  heap[ n ].a  );
+                    break;
+
+                case pure_node_::self:
+                {
+                    int const  copy  =  instance_();
+
+                    heap[ n ]  =  {  pure_node_::indirection,  copy  };
+                    break;
+                }
+
+                case pure_node_::s:
+                    if ( args < 3 )
+                    {
+                        normal = true;
+                    }
+                    else
+                    {
+                        int const  x  =  arg( 0 );
+                        int const  y  =  arg( 1 );
+                        int const  z  =  arg( 2 );
+                        int const  r  =  redex( 3 );
+
+                        int const  xz  =  make_( {  pure_node_::app,  x,  z  } );
+                        int const  yz  =  make_( {  pure_node_::app,  y,  z  } );
+
+                        heap[ r ]  =  {  pure_node_::app,  xz,  yz  };
+
+                        spine.resize(  spine.size() - 3  );
+                        spine.back()  =  r;
+                    }
+                    break;
+
+                case pure_node_::b_:                   //  B x y z = x ( y z )
+                case pure_node_::c_:                   //  C x y z = x z y
+                    if ( args < 3 )
+                    {
+                        normal = true;
+                    }
+                    else
+                    {
+                        int const  x  =  arg( 0 );
+                        int const  y  =  arg( 1 );
+                        int const  z  =  arg( 2 );
+                        int const  r  =  redex( 3 );
+
+                        if (  heap[ n ].kind == pure_node_::b_  )
+                        {
+                            int const  yz  =  make_( {  pure_node_::app,  y,  z  } );
+
+                            heap[ r ]  =  {  pure_node_::app,  x,  yz  };
+                        }
+                        else
+                        {
+                            int const  xz  =  make_( {  pure_node_::app,  x,  z  } );
+
+                            heap[ r ]  =  {  pure_node_::app,  xz,  y  };
+                        }
+
+                        spine.resize(  spine.size() - 3  );
+                        spine.back()  =  r;
+                    }
+                    break;
+
+                case pure_node_::i_:
+                    if ( args < 1 )
+                    {
+                        normal = true;
+                    }
+                    else
+                    {
+                        int const  r  =  redex( 1 );
+
+                        heap[ r ]  =  {  pure_node_::indirection,  arg( 0 )  };
+
+                        spine.pop_back();
+                        spine.back()  =  r;
+                    }
+                    break;
+
+                case pure_node_::k:
+                    if ( args < 2 )
+                    {
+                        normal = true;
+                    }
+                    else
+                    {
+                        int const  r  =  redex( 2 );
+
+                        heap[ r ]  =  {  pure_node_::indirection,  arg( 0 )  };
+
+                        spine.resize(  spine.size() - 2  );
+                        spine.back()  =  r;
+                    }
+                    break;
+
+                case pure_node_::builtin:
+                {
+                    int const  op  =  heap[ n ].a;
+                    int const  m   =  arity_( op );
+
+                    if ( args < std::size_t( m ) )
+                    {
+                        normal = true;
+                        break;
+                    }
+
+                    int  p  =  follow_( arg( 0 ) );
+                    int  q  =  m == 2  ?  follow_( arg( 1 ) )  :  p;
+
+                    for ( int const v : {  p,  q  } )
+                    {
+                        if ( heap[ v ].kind != pure_node_::integer  &&  heap[ v ].kind != pure_node_::boolean )
+                        {
+                            dump.push_back(  spine.size()  );         // reduce the argument first
+                            spine.push_back( v );
+                            break;
+                        }
+                    }
+
+                    if ( spine.back() != n )
+                        break;
+
+                    pure_node_  result  {  pure_node_::integer  };
+
+                    if ( ! builtin_(  op,  heap[ p ],  heap[ q ],  result  ) )
+                        return {  pure_result_::failure  };
+
+                    int const  r  =  redex( m );
+
+                    heap[ r ]  =  result;
+
+                    spine.resize(  spine.size() - m  );
+                    spine.back()  =  r;
+                    break;
+                }
+
+                case pure_node_::integer:
+                case pure_node_::boolean:
+                    if ( args != 0 )
+                        return {  pure_result_::failure  };
+
+                    normal = true;
+                    break;
+
+                case pure_node_::indirection:
+                    break;
+                }
+
+
+                if ( ! normal )
+                    continue;
+
+                if ( dump.empty() )
+                {
+                    switch (  heap[ n ].kind  )
+                    {
+                    case pure_node_::integer:   return {  pure_result_::integer,  heap[ n ].x  };
+                    case pure_node_::boolean:   return {  pure_result_::boolean,  heap[ n ].x  };
+                    default:                    return {  pure_result_::function  };
+                    }
+                }
+
+                if ( heap[ n ].kind != pure_node_::integer  &&  heap[ n ].kind != pure_node_::boolean )
+                    return {  pure_result_::failure  };                 // a builtin argument must be a value
+
+                spine.resize(  dump.back()  );
+                dump.pop_back();
+            }
+        }
+    };
 
-    template<  eval_mode  mode
-            ,  typename   Lut
-            ,  typename   p
-            >
-    struct eval_<  mode
-                ,  Lut
-                ,  call<  0,  drop_first_t,  p  >
-                >
-    :   Drop_First<  mode,  Lut,  lazy_eval<  Lut, p >  >
-    { };
 
 
+//  Flattening of a term into pure_machine_::term;  -1 if the term is not pure.  The
+//  term is flattened with Turner's optimizations of bracket abstraction:
+//
+//      S ( K x ) ( K y )  =  K ( x y ),    S ( K x ) y  =  B x y,    S x ( K y )  =  C x y,    S K K  =  I
 
-// -----------------------------------------------------------------------------
-//  cons:
-// -----------------------------------------------------------------------------
+    static consteval int pure_app_(  std::vector< pure_node_ >&  term,  int  f,  int  x  )
+    {
+        if ( f == -1  ||  x == -1 )
+            return -1;
 
+        term.push_back( {  pure_node_::app,  f,  x  } );
+        return static_cast< int >(  term.size() - 1  );
+    }
 
-// lazy evaluation:
 
+    static consteval int pure_leaf_(  std::vector< pure_node_ >&  term,  pure_node_::kind_t  kind  )
+    {
+        term.push_back( {  kind  } );
+        return static_cast< int >(  term.size() - 1  );
+    }
 
-    template<  typename P,  typename Q  >
-    struct Lazy_Cons_
-    :   type_hull<  eval_error<  cons_t,  P,  Q  >  >
+
+
+    template<  typename F,  typename X  >
+    static consteval int pure_flatten_(  type_hull< F >,  type_hull< X >,  std::vector< pure_node_ >&  )
+    {
+        return -1;
+    }
+
+
+    template<  typename F  >
+    static consteval int pure_flatten_(  type_hull< F >,  type_hull< S >,  std::vector< pure_node_ >&  term  )
+    {
+        return pure_leaf_(  term,  pure_node_::s  );
+    }
+
+
+    template<  typename F  >
+    static consteval int pure_flatten_(  type_hull< F >,  type_hull< K >,  std::vector< pure_node_ >&  term  )
+    {
+        return pure_leaf_(  term,  pure_node_::k  );
+    }
+
+
+    template<  typename F  >
+    static consteval int pure_flatten_(  type_hull< F >,  type_hull<  s<  S,  K,  K  >  >,  std::vector< pure_node_ >&  term  )
+    {
+        return pure_leaf_(  term,  pure_node_::i_  );
+    }
+
+
+    template<  typename F,  typename X,  typename Y  >
+    static consteval int pure_flatten_(  type_hull< F >,  type_hull<  s<  S,  s< K, X >,  s< K, Y >  >  >,  std::vector< pure_node_ >&  term  )
+    {
+        int const  k  =  pure_leaf_(  term,  pure_node_::k  );
+        int const  x  =  pure_flatten_(  type_hull< F >{},  type_hull< X >{},  term  );
+        int const  y  =  pure_flatten_(  type_hull< F >{},  type_hull< Y >{},  term  );
+
+        return pure_app_(  term,  k,  pure_app_(  term,  x,  y  )  );
+    }
+
+
+    template<  typename F,  typename X,  typename Y  >
+    static consteval int pure_flatten_(  type_hull< F >,  type_hull<  s<  S,  s< K, X >,  Y  >  >,  std::vector< pure_node_ >&  term  )
+    {
+        int const  b  =  pure_leaf_(  term,  pure_node_::b_  );
+        int const  x  =  pure_flatten_(  type_hull< F >{},  type_hull< X >{},  term  );
+        int const  y  =  pure_flatten_(  type_hull< F >{},  type_hull< Y >{},  term  );
+
+        return pure_app_(  term,  pure_app_(  term,  b,  x  ),  y  );
+    }
+
+
+    template<  typename F,  typename X,  typename Y  >
+    static consteval int pure_flatten_(  type_hull< F >,  type_hull<  s<  S,  X,  s< K, Y >  >  >,  std::vector< pure_node_ >&  term  )
+    {
+        int const  c  =  pure_leaf_(  term,  pure_node_::c_  );
+        int const  x  =  pure_flatten_(  type_hull< F >{},  type_hull< X >{},  term  );
+        int const  y  =  pure_flatten_(  type_hull< F >{},  type_hull< Y >{},  term  );
+
+        return pure_app_(  term,  pure_app_(  term,  c,  x  ),  y  );
+    }
+
+
+    template<  typename F,  int x  >
+    static consteval int pure_flatten_(  type_hull< F >,  type_hull<  value< x >  >,  std::vector< pure_node_ >&  term  )
+    {
+        term.push_back( {  pure_node_::integer,  0,  0,  x  } );
+        return static_cast< int >(  term.size() - 1  );
+    }
+
+
+    template<  typename F,  bool x  >
+    static consteval int pure_flatten_(  type_hull< F >,  type_hull<  value< x >  >,  std::vector< pure_node_ >&  term  )
+    {
+        term.push_back( {  pure_node_::boolean,  0,  0,  x  } );
+        return static_cast< int >(  term.size() - 1  );
+    }
+
+
+    template<  typename F,  char... c  >
+    static consteval int pure_flatten_(  type_hull< F >,  type_hull<  text< c... >  >,  std::vector< pure_node_ >&  term  )
+    {
+        constexpr text< c... >  t  {};
+
+        int const  op  =  t == "+"_text    ?  pure_machine_::add
+                       :  t == "-"_text    ?  pure_machine_::sub
+                       :  t == "*"_text    ?  pure_machine_::mul
+                       :  t == "/"_text    ?  pure_machine_::div
+                       :  t == "%"_text    ?  pure_machine_::mod
+                       :  t == "=="_text   ?  pure_machine_::equal
+                       :  t == "!="_text   ?  pure_machine_::unequal
+                       :  t == "<"_text    ?  pure_machine_::less
+                       :  t == ">"_text    ?  pure_machine_::greater
+                       :  t == "<="_text   ?  pure_machine_::less_equal
+                       :  t == ">="_text   ?  pure_machine_::greater_equal
+                       :  t == "and"_text  ?  pure_machine_::and_
+                       :  t == "or"_text   ?  pure_machine_::or_
+                       :  t == "xor"_text  ?  pure_machine_::xor_
+                       :  t == "not"_text  ?  pure_machine_::not_
+                       :  t == "if"_text   ?  pure_machine_::if_
+                       :  t == "eq"_text   ?  pure_machine_::eq_
+                       :                      -1;
+
+        if ( type_hull<  text< c... >  >{} == type_hull< F >{} )
+            term.push_back( {  pure_node_::self  } );
+        else if ( op != -1 )
+            term.push_back( {  pure_node_::builtin,  op  } );
+        else
+            return -1;
+
+        return static_cast< int >(  term.size() - 1  );
+    }
+
+
+    template<  typename F,  typename X,  typename Y,  typename... Z  >
+    static consteval int pure_flatten_(  type_hull< F >,  type_hull<  s<  X,  Y,  Z...  >  >,  std::vector< pure_node_ >&  term  )
+    {
+        int  f  =  pure_flatten_(  type_hull< F >{},  type_hull< X >{},  term  );
+
+        f  =  pure_app_(  term,  f,  pure_flatten_(  type_hull< F >{},  type_hull< Y >{},  term  )  );
+        (  (  f  =  pure_app_(  term,  f,  pure_flatten_(  type_hull< F >{},  type_hull< Z >{},  term  )  )  ),  ...  );
+
+        return f;
+    }
+
+
+
+    template<  typename F,  typename Term  >
+    static consteval bool pure_term_()
+    {
+        std::vector< pure_node_ >  term;
+
+        return pure_flatten_(  type_hull< F >{},  type_hull< Term >{},  term  )  !=  -1;
+    }
+
+
+
+    template<  typename F,  typename Term,  auto... x  >
+    static consteval pure_result_ pure_call_()
+    {
+        pure_machine_  m;
+
+        pure_flatten_(  type_hull< F >{},  type_hull< Term >{},  m.term  );
+
+        int  root  =  m.instance_();
+
+        (  (  root  =  m.make_( {  pure_node_::app,  root,  m.make_( {  std::is_same_v< decltype( x ), bool >
+                                                                           ?  pure_node_::boolean
+                                                                           :  pure_node_::integer
+                                                                        ,  0,  0,  x
+                                                                        } )
+                                } )
+           ),  ...
+        );
+
+        return m.run( root );
+    }
+
+
+
+#ifndef TRIVIUM_NO_CONSTEVAL_DEF
+
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  char...    f
+            ,  typename   S_or_K
+            ,  typename   p
+            ,  typename...  ps
+            >
+    requires
+    (
+        (  type_hull< S_or_K >{} == type_hull< S >{}  ||  type_hull< S_or_K >{} == type_hull< K >{}  )
+        &&
+        pure_term_<  text< f... >,  s<  S_or_K,  p,  ps...  >  >()
+    )
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  op<  def_t,  text< f... >  >,  s<  S_or_K,  p,  ps...  >  >
+                >
+    :   eval_result<  op<  def_t,  text< f... >,  pure_function<  text< f... >,  s<  S_or_K,  p,  ps...  >  >  >  >
+    { };
+
+#endif
+
+
+
+    template<  eval_mode    mode
+            ,  typename     Lut
+            ,  typename     F
+            ,  typename     Term
+            ,  typename...  Args
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  pure_function<  F,  Term,  Args...  >
+                >
+    :   eval_result<  call<  1,  pure_function<  F,  Term,  Args...  >  >  >
+    { };
+
+
+
+    //  Y-combinator evaluation (the general case):
+
+    template<  typename Fn  >
+    struct pure_y_;
+
+
+    template<  char...      f
+            ,  typename     Term
+            ,  typename...  Args
+            >
+    struct pure_y_<  pure_function<  text< f... >,  Term,  Args...  >  >
+    {
+        using lambda  =  typename application<  text< f... >  >::template apply_to< Term >;
+
+        template<  typename x  >
+        using call_with  =  s<  s<  lambda,  s<  Y_combinator,  lambda  >  >,  quoted< Args >...,  x  >;
+    };
+
+
+
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  typename   Fn
+            ,  typename   x
+            ,  typename   X
+            >
+    struct Pure_Call_
+    :   eval_<  mode,  Lut,  typename pure_y_< Fn >::template call_with< x >  >
+    { };
+
+
+
+    template<  auto v  >
+    static consteval auto value_of_(  value< v >  )  {  return v;  }
+
+
+
+    template<  typename F,  typename Term,  auto... x  >       //  (the reduction runs once per call)
+    static constexpr pure_result_  pure_call_result_  =  pure_call_<  F,  Term,  x...  >();
+
+
+
+    template<  pure_result_ r,  typename Fn,  typename X  >
+    struct pure_outcome_;
+
+
+    template<  pure_result_ r,  typename F,  typename Term,  typename... Args,  typename X  >
+    struct pure_outcome_<  r,  pure_function<  F,  Term,  Args...  >,  X  >
+    {
+        using type  =  std::conditional_t<  r.status == pure_result_::integer
+                                         ,  value<  static_cast< int >( r.x )  >
+                                         ,  std::conditional_t<  r.status == pure_result_::boolean
+                                                              ,  value<  r.x != 0  >
+                                                              ,  pure_function<  F,  Term,  Args...,  X  >
+                                                              >
+                                         >;
+    };
+
+
+
+    template<  eval_mode    mode
+            ,  typename     Lut
+            ,  typename     F
+            ,  typename     Term
+            ,  typename...  Args
+            ,  typename     x
+            ,  auto         v
+            >
+    requires
+    (
+        (  std::is_same_v<  decltype( v ),  int  >  ||  std::is_same_v<  decltype( v ),  bool  >  )
+        &&
+        pure_call_result_<  F,  Term,  value_of_( Args{} )...,  v  >.status != pure_result_::failure
+    )
+    struct Pure_Call_<  mode,  Lut,  pure_function<  F,  Term,  Args...  >,  x,  value< v >  >
+    :   eval_result<  typename pure_outcome_<  pure_call_result_<  F,  Term,  value_of_( Args{} )...,  v  >,  pure_function<  F,  Term,  Args...  >,  value< v >  >::type  >
+    { };
+
+
+
+    template<  eval_mode    mode
+            ,  typename     Lut
+            ,  typename     F
+            ,  typename     Term
+            ,  typename...  Args
+            ,  typename     x
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  pure_function<  F,  Term,  Args...  >,  x  >
+                >
+    :   Pure_Call_<  mode,  Lut,  pure_function<  F,  Term,  Args...  >,  x,  eager_eval<  Lut,  x  >  >
+    { };
+
+
+
+// -----------------------------------------------------------------------------
+//  unevaluated lists:
+// -----------------------------------------------------------------------------
+
+
+    template<  typename...  > struct lazy { };
+
+
+
+    template<  typename     Lut
+            ,  typename...  p
+            >
+    struct eval_<  eval_mode::eager
+                ,  Lut
+                ,  lazy< p... >
+                >
+    :   gather< s,  eager_eval< Lut, p >...  >
+    { };
+
+
+
+    template<  typename     Lut
+            ,  typename...  p
+            >
+    struct eval_<  eval_mode::lazy
+                ,  Lut
+                ,  lazy< p... >
+                >
+    :   eval_result<  lazy< p... >  >
+    { };
+
+
+
+// -----------------------------------------------------------------------------
+//  list<n>:
+// -----------------------------------------------------------------------------
+
+
+    template<  typename     Lut
+            ,  unsigned     n
+            ,  typename...  p
+            >
+    requires
+    (
+        n != 0  &&  sizeof...(p) == n
+    )
+    struct eval_<  eval_mode::eager
+                ,  Lut
+                ,  call< 0,  list<n>,  p...  >
+                >
+    :   gather< s,  eager_eval< Lut, p >...  >
+    {
+        static_assert(  sizeof...(p) == n,  "Internal interpreter errror!"  );
+    };
+
+
+
+    template<  typename     Lut
+            ,  unsigned     n
+            ,  typename...  p
+            >
+    requires
+    (
+        n != 0  &&  sizeof...(p) == n
+    )
+    struct eval_<  eval_mode::lazy
+                ,  Lut
+                ,  call< 0,  list<n>,  p...  >
+                >
+    :   gather<  lazy,  p...  >
+    {
+        static_assert(  sizeof...(p) == n,  "Internal interpreter errror!"  );
+    };
+
+
+
+//  ----------------------------------------------------------------------------
+//  packed lists:
+//  ----------------------------------------------------------------------------
+//
+//  A packed list value< std::array< int, n >{ ... } > (see packed_list in s_expr.hpp) is
+//  taken apart and built with constant expressions on the array, i.e. first, drop_first,
+//  count, cons and rcons cost one instantiation,  independent of n.  The conversions
+//
+//      ( pack xs )     s< integer<x>... >  ->  packed list  ( () stays () )
+//      ( unpack xs )   packed list  ->  s< integer<x>... >
+//
+//  are the identity on lists that are already in the requested form.
+//
+//  ( fold f init xs ) is the left fold ( f ... ( f ( f init x1 ) x2 ) ... xn ).  If xs is
+//  packed, init is an integer and f is one of the arithmetic operators + - * / %, the fold
+//  is a single constant expression;  otherwise f is applied element by element.
+
+
+    template<  auto xs,  std::size_t... k  >
+    static s<  integer< xs[ k ] >...  >  unpacked_(  std::index_sequence< k... >  );
+
+
+    template<  auto xs  >
+    using Unpacked  =  decltype(  unpacked_< xs >(  std::make_index_sequence<  xs.size()  >{}  )  );
+
+
+
+    template<  auto xs  >
+    static consteval std::array<  int,  xs.size() - 1  >  packed_drop_first_()
+    {
+        std::array<  int,  xs.size() - 1  >  ys{};
+
+        for ( std::size_t k = 0;  k != ys.size();  ++k )
+            ys[ k ] = xs[ k + 1 ];
+
+        return ys;
+    }
+
+
+
+    template<  int x,  auto xs  >
+    static consteval std::array<  int,  xs.size() + 1  >  packed_cons_()
+    {
+        std::array<  int,  xs.size() + 1  >  ys{  x  };
+
+        for ( std::size_t k = 0;  k != xs.size();  ++k )
+            ys[ k + 1 ] = xs[ k ];
+
+        return ys;
+    }
+
+
+
+    template<  int x,  auto xs  >
+    static consteval std::array<  int,  xs.size() + 1  >  packed_rcons_()
+    {
+        std::array<  int,  xs.size() + 1  >  ys{};
+
+        for ( std::size_t k = 0;  k != xs.size();  ++k )
+            ys[ k ] = xs[ k ];
+
+        ys[ xs.size() ] = x;
+
+        return ys;
+    }
+
+
+
+    template<  auto xs,  bool  =  xs.size() == 1  >
+    struct Packed_Drop_First_
+    :   type_hull<  s<>  >
+    { };
+
+
+    template<  auto xs  >
+    struct Packed_Drop_First_<  xs,  false  >
+    :   type_hull<  value<  packed_drop_first_< xs >()  >  >
+    { };
+
+
+
+    struct packed_fold_result_
+    {
+        bool  ok;
+        int   value;
+    };
+
+
+
+    template<  char f,  auto xs  >
+    static consteval packed_fold_result_  packed_fold_(  int init  )
+    {
+        long long  x  =  init;
+
+        for ( int const y : xs )
+        {
+            if ( ( f == '/'  ||  f == '%' )  &&  y == 0 )
+                return {  false,  0  };
+
+            switch ( f )
+            {
+            case '+':   x = x + y;   break;
+            case '-':   x = x - y;   break;
+            case '*':   x = x * y;   break;
+            case '/':   x = x / y;   break;
+            case '%':   x = x % y;   break;
+            }
+
+            if ( x < -2147483647ll - 1  ||  x > 2147483647ll )      // as bin_op:  no overflow of int
+                return {  false,  0  };
+        }
+
+        return {  true,  static_cast< int >( x )  };
+    }
+
+
+
+//  pack:
+
+    template<  typename Xs  >
+    struct Pack
+    :   error_<  pack_t,  Xs  >
+    { };
+
+
+
+    template<  typename... Xs  >
+    requires (  sizeof...(Xs) == 0  )
+    struct Pack<  s< Xs... >  >
+    :   eval_result<  s<>  >
+    { };
+
+
+
+    template<  int... x  >
+    requires (  sizeof...(x) != 0  )
+    struct Pack<  s<  value< x >...  >  >
+    :   eval_result<  packed< x... >  >
+    { };
+
+
+
+    template<  auto xs  >
+    requires packed_list<  value< xs >  >
+    struct Pack<  value< xs >  >
+    :   eval_result<  value< xs >  >
+    { };
+
+
+
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  typename   p
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  pack_t,  p  >
+                >
+    :   Pack<  eager_eval<  Lut,  p  >  >
+    { };
+
+
+
+//  unpack:
+
+    template<  typename Xs  >
+    struct Unpack
+    :   error_<  unpack_t,  Xs  >
+    { };
+
+
+
+    template<  typename... Xs  >
+    struct Unpack<  s< Xs... >  >
+    :   eval_result<  s< Xs... >  >
+    { };
+
+
+
+    template<  auto xs  >
+    requires packed_list<  value< xs >  >
+    struct Unpack<  value< xs >  >
+    :   eval_result<  Unpacked< xs >  >
+    { };
+
+
+
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  typename   p
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  unpack_t,  p  >
+                >
+    :   Unpack<  eager_eval<  Lut,  p  >  >
+    { };
+
+
+
+//  fold:
+
+    template<  eval_mode mode,  typename Lut  >
+    struct env_fold
+    {
+        template<  typename F,  typename Init,  typename Xs  >
+        struct Fold_
+        :   error_<  fold_t,  F,  Init,  Xs  >
+        { };
+
+
+        template<  typename F,  typename Init,  typename Xs  >
+        using Fold  =  typename Fold_<  F,  Init,  Xs  >::type;
+
+
+        template<  typename F,  typename Init  >
+        struct Fold_<  F,  Init,  s<>  >
+        :   eval_result<  Init  >
+        { };
+
+
+        template<  typename F,  typename Init,  typename X,  typename... Xs  >
+        struct Fold_<  F,  Init,  s<  X,  Xs...  >  >
+        :   gather<  Fold,  F,  typename eval_<  mode,  Lut,  s<  F,  quoted< Init >,  quoted< X >  >  >::type,  s< Xs... >  >
+        { };
+
+
+        template<  typename F,  typename Init,  auto xs  >
+        requires packed_list<  value< xs >  >
+        struct Fold_<  F,  Init,  value< xs >  >
+        :   Fold_<  F,  Init,  Unpacked< xs >  >
+        { };
+
+
+        template<  char f,  int init,  auto xs  >
+        requires
+        (
+            packed_list<  value< xs >  >
+            &&
+            (  f == '+'  ||  f == '-'  ||  f == '*'  ||  f == '/'  ||  f == '%'  )
+            &&
+            packed_fold_< f, xs >( init ).ok
+        )
+        struct Fold_<  call<  1,  text< f >  >,  value< init >,  value< xs >  >
+        :   eval_result<  integer<  packed_fold_< f, xs >( init ).value  >  >
+        { };
+    };
+
+
+
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  typename   p
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  fold_t,  p  >
+                >
+    :   gather<  op,  fold_t,  eager_eval<  Lut,  p  >  >
+    { };
+
+
+
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  typename   p
+            ,  typename   q
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  op<  fold_t,  p  >,  q  >
+                >
+    :   gather<  op,  fold_t,  p,  eager_eval<  Lut,  q  >  >
+    { };
+
+
+
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  typename   p
+            ,  typename   q
+            ,  typename   r
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  op<  fold_t,  p,  q  >,  r  >
+                >
+    :   gather<  env_fold<  mode,  Lut  >::template Fold,  p,  q,  eager_eval<  Lut,  r  >  >
+    { };
+
+
+
+//  ----------------------------------------------------------------------------
+//  first:
+//  ----------------------------------------------------------------------------
+
+
+    template<  eval_mode,  typename,  typename X  >
+    struct First
+    :   error_<  first_t,  X  >
+    { };
+
+
+
+    template<  eval_mode    mode
+            ,  typename     Lut
+            ,  typename     X
+            ,  typename...  Xs
+            >
+    struct First<  mode,  Lut,  s<  X,  Xs... >  >
+    :   eval_result< X  >
+    { };
+
+
+
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  auto       xs
+            >
+    requires packed_list<  value< xs >  >
+    struct First<  mode,  Lut,  value< xs >  >
+    :   eval_result<  integer<  xs[ 0 ]  >  >
+    { };
+
+
+
+    template<  eval_mode    mode
+            ,  typename     Lut
+            ,  typename     p
+            ,  typename...  ps
+            >
+    struct First<  mode,  Lut,  lazy<  p,  ps... >  >
+    :   eval_< mode,  Lut,  p  >
+    { };
+
+
+
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  typename   p
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  first_t,  p  >
+                >
+    :   First<  mode,  Lut,  lazy_eval< Lut, p >  >
+    { };
+
+
+
+//  ----------------------------------------------------------------------------
+//  drop_first:
+//  ----------------------------------------------------------------------------
+
+
+    template<  eval_mode,  typename,  typename  >
+    struct Drop_First;
+
+
+
+    template<  typename     Lut
+            ,  typename     p
+            ,  typename...  ps
+            >
+    struct Drop_First<  eval_mode::lazy
+                     ,  Lut
+                     ,  lazy<  p,  ps...  >
+                     >
+    :   eval_result<  lazy< ps... >  >
+    { };
+
+
+
+    template<  typename     Lut
+            ,  typename     p
+            ,  typename...  ps
+            >
+    struct Drop_First<  eval_mode::eager
+                     ,  Lut
+                     ,  lazy<  p,  ps...  >
+                     >
+    :  gather<  s,  eager_eval< Lut, ps >...  >
+    { };
+
+
+
+    template<  eval_mode    mode
+            ,  typename     Lut
+            ,  typename     p
+            ,  typename...  ps
+            >
+    struct Drop_First<  mode
+                     ,  Lut
+                     ,  s<  p,  ps...  >
+                     >
+    :   eval_result<  s<  ps...  >  >
+    { };
+
+
+
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  auto       xs
+            >
+    requires packed_list<  value< xs >  >
+    struct Drop_First<  mode
+                     ,  Lut
+                     ,  value< xs >
+                     >
+    :   Packed_Drop_First_< xs >
+    { };
+
+
+
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  typename   p
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  drop_first_t,  p  >
+                >
+    :   Drop_First<  mode,  Lut,  lazy_eval<  Lut, p >  >
+    { };
+
+
+
+// -----------------------------------------------------------------------------
+//  cons:
+// -----------------------------------------------------------------------------
+
+
+// lazy evaluation:
+
+
+    template<  typename P,  typename Q  >
+    struct Lazy_Cons_
+    :   type_hull<  error_<  cons_t,  P,  Q  >  >
+    { };
+
+
+    template<  typename     p
+            ,  typename...  q
+            >
+    struct Lazy_Cons_<  p,  s< q... >  >
+    :   type_hull<  s< p, q... >  >
+    { };
+
+
+
+    template<  typename...  p
+            ,  typename...  q
+            >
+    struct Lazy_Cons_<  lazy<p...>,  s< q... >  >
+    :   type_hull<  lazy< lazy< p... >, quoted<q>... >  >
+    { };
+
+
+
+    template<  typename     p
+            ,  typename...  q
+            >
+    struct Lazy_Cons_<  p,  lazy< q... >  >
+    :   type_hull<  lazy<  quoted<p>,  q...  >  >
+    { };
+
+
+
+    template<  typename...  p
+            ,  typename...  q
+            >
+    struct Lazy_Cons_<  lazy< p... >,  lazy< q... >  >
+    :   type_hull<  lazy<  lazy<p...>,  q...  >  >
+    { };
+
+
+
+    template<  typename  p
+            ,  auto      xs
+            >
+    requires packed_list<  value< xs >  >
+    struct Lazy_Cons_<  p,  value< xs >  >
+    :   Lazy_Cons_<  p,  Unpacked< xs >  >
+    { };
+
+
+
+    template<  int   x
+            ,  auto  xs
+            >
+    requires packed_list<  value< xs >  >
+    struct Lazy_Cons_<  value< x >,  value< xs >  >
+    :   type_hull<  value<  packed_cons_< x, xs >()  >  >
+    { };
+
+
+
+    template<  typename P,  typename Q  >
+    using Lazy_Cons = typename Lazy_Cons_<  P,  Q  >::type;
+
+
+
+    template<  typename   Lut
+            ,  typename   p
+            ,  typename   q
+            >
+    struct eval_<  eval_mode::lazy
+                ,  Lut
+                ,  call< 0,  cons_t,  p,  q  >
+                >
+    :   gather<  Lazy_Cons,  lazy_eval< Lut, p >,  lazy_eval< Lut, q >  >
+    { };
+
+
+
+// eager evaluation:
+
+
+    template<  typename P,  typename Q  >
+    struct Cons_
+    :   type_hull< error_<  cons_t,  P,  Q  >  >
+    { };
+
+
+
+    template<  typename P,  typename... Q  >
+    struct Cons_<  P,  s< Q... >  >
+    :   type_hull<  s<  P,  Q...  >  >
+    { };
+
+
+
+    template<  typename P,  auto xs  >
+    requires packed_list<  value< xs >  >
+    struct Cons_<  P,  value< xs >  >
+    :   Cons_<  P,  Unpacked< xs >  >
+    { };
+
+
+
+    template<  int x,  auto xs  >
+    requires packed_list<  value< xs >  >
+    struct Cons_<  value< x >,  value< xs >  >
+    :   type_hull<  value<  packed_cons_< x, xs >()  >  >
+    { };
+
+
+    template<  typename P,  typename Q  >
+    using Cons = typename Cons_< P, Q >::type;
+
+
+    template<  typename   Lut
+            ,  typename   p
+            ,  typename   q
+            >
+    struct eval_<  eval_mode::eager
+                ,  Lut
+                ,  call<  0,  cons_t,  p,  q  >
+                >
+    :   gather<  Cons,  eager_eval< Lut, p >,  eager_eval< Lut, q >  >
+    { };
+
+
+
+    template<  typename   Lut
+            ,  typename   p
+            >
+    struct eval_<  eval_mode::eager
+                ,  Lut
+                ,  call<  0,  cons_t,  p   >
+                >
+    :   eval_result<  op<  cons_t,  p  >  >
+    { };
+
+
+
+
+// -----------------------------------------------------------------------------
+//  rcons:
+// -----------------------------------------------------------------------------
+
+
+// lazy evaluation:
+
+
+    template<  typename P,  typename Q  >
+    struct Lazy_RCons_
+    :   type_hull<  error_<  rcons_t,  P,  Q  >  >
+    { };
+
+
+    template<  typename     p
+            ,  typename...  q
+            >
+    struct Lazy_RCons_<  p,  s< q... >  >
+    :   type_hull<  s< q..., p >  >
+    { };
+
+
+
+    template<  typename...  p
+            ,  typename...  q
+            >
+    struct Lazy_RCons_<  lazy<p...>,  s< q... >  >
+    :   type_hull<  lazy<  quoted<q>...,  lazy< p... >  >  >
+    { };
+
+
+
+    template<  typename     p
+            ,  typename...  q
+            >
+    struct Lazy_RCons_<  p,  lazy< q... >  >
+    :   type_hull<  lazy<  q...,  quoted<p>  >  >
+    { };
+
+
+
+    template<  typename...  p
+            ,  typename...  q
+            >
+    struct Lazy_RCons_<  lazy< p... >,  lazy< q... >  >
+    :   type_hull<  lazy<  q...,  lazy<p...>  >  >
+    { };
+
+
+
+    template<  typename  p
+            ,  auto      xs
+            >
+    requires packed_list<  value< xs >  >
+    struct Lazy_RCons_<  p,  value< xs >  >
+    :   Lazy_RCons_<  p,  Unpacked< xs >  >
+    { };
+
+
+
+    template<  int   x
+            ,  auto  xs
+            >
+    requires packed_list<  value< xs >  >
+    struct Lazy_RCons_<  value< x >,  value< xs >  >
+    :   type_hull<  value<  packed_rcons_< x, xs >()  >  >
+    { };
+
+
+
+    template<  typename P,  typename Q  >
+    using Lazy_RCons = typename Lazy_RCons_<  P,  Q  >::type;
+
+
+
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  typename   p
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  call< 0,  rcons_t,  p >
+                >
+    :   eval_<  mode,  Lut,  call<  1,  rcons_t,  p  >  >
+    { };
+
+
+
+    template<  typename   Lut
+            ,  typename   p
+            ,  typename   q
+            >
+    struct eval_<  eval_mode::lazy
+                ,  Lut
+                ,  call< 0,  rcons_t,  p,  q  >
+                >
+    :   gather<  Lazy_RCons,  lazy_eval< Lut, p >,  lazy_eval< Lut, q >  >
+    { };
+
+
+
+// eager evaluation:
+
+
+    template<  typename P,  typename Q  >
+    struct RCons_
+    :   type_hull< error_<  rcons_t,  P,  Q  >  >
+    { };
+
+
+
+    template<  typename P,  typename... Q  >
+    struct RCons_<  P,  s< Q... >  >
+    :   type_hull<  s<  Q...,  P  >  >
+    { };
+
+
+
+    template<  typename P,  auto xs  >
+    requires packed_list<  value< xs >  >
+    struct RCons_<  P,  value< xs >  >
+    :   RCons_<  P,  Unpacked< xs >  >
+    { };
+
+
+
+    template<  int x,  auto xs  >
+    requires packed_list<  value< xs >  >
+    struct RCons_<  value< x >,  value< xs >  >
+    :   type_hull<  value<  packed_rcons_< x, xs >()  >  >
+    { };
+
+
+    template<  typename P,  typename Q  >
+    using RCons = typename RCons_< P, Q >::type;
+
+
+    template<  typename   Lut
+            ,  typename   p
+            ,  typename   q
+            >
+    struct eval_<  eval_mode::eager
+                ,  Lut
+                ,  call< 0,  rcons_t,  p,  q  >
+                >
+    :   gather<  RCons,  eager_eval< Lut, p >,  eager_eval< Lut, q >  >
+    { };
+
+
+
+// -----------------------------------------------------------------------------
+//  count:
+// -----------------------------------------------------------------------------
+
+
+    template<  typename X  >
+    struct Count
+    :   error_<  count_t,  X  >
+    { };
+
+
+
+    template<  typename... p  >
+    struct Count<  lazy< p... >  >
+    :   eval_result<  integer< sizeof...(p) >  >
+    { };
+
+
+
+    template<  typename... p  >
+    struct Count<  s< p... >  >
+    :   eval_result<  integer< sizeof...(p) >  >
+    { };
+
+
+
+    template<  auto xs  >
+    requires packed_list<  value< xs >  >
+    struct Count<  value< xs >  >
+    :   eval_result<  integer<  int( xs.size() )  >  >
+    { };
+
+
+
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  typename   xs
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  count_t,  xs  >
+                >
+    :   Count<  lazy_eval< Lut, xs >  >
+    { };
+
+
+
+// -----------------------------------------------------------------------------
+//  apply:
+// -----------------------------------------------------------------------------
+
+
+    template<  eval_mode mode,  typename Lut >
+    struct env_apply
+    {
+        template<   typename F,  typename Xs  >
+        struct  Apply_
+        :   error_<  F,  Xs  >
+        { };
+
+
+        template<  typename F,  typename... Xs  >
+        struct Apply_<  F,  s< Xs... >  >
+        :   eval_<  mode,  Lut,  s<  F,  quoted< Xs >...  >  >
+        { };
+
+
+        template<  typename F,  typename Xs  >
+        using Apply = typename Apply_<  F,  Xs  >::type;
+    };
+
+
+
+    template<  eval_mode    mode
+            ,  typename     Lut
+            ,  typename     f
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  apply_t,  f   >
+                >
+    :   eval_result<  op<  apply_t,  f  >  >
+    { };
+
+
+
+
+    template<  eval_mode    mode
+            ,  typename     Lut
+            ,  typename     f
+            ,  typename     xs
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  apply_t,  f,  xs  >
+                >
+    :   gather<  env_apply<  mode,  Lut  >::template Apply,  f,  eager_eval< Lut, xs >  >
     { };
 
 
-    template<  typename     p
-            ,  typename...  q
+
+//  ----------------------------------------------------------------------------
+//  eq:
+//  ----------------------------------------------------------------------------
+
+
+    template<  typename X,  typename Y  >
+    struct Eq_
+    :   eval_result<  value< false >  >
+    { };
+
+
+
+    template<  typename X  >
+    struct Eq_< X, X >
+    :   eval_result<  value< true >  >
+    { };
+
+
+
+//  a packed list equals the unpacked list of the same integers:
+
+    template<  auto xs,  typename... Y  >
+    requires (  packed_list<  value< xs >  >  &&  sizeof...(Y) == xs.size()  )
+    struct Eq_<  value< xs >,  s< Y... >  >
+    :   Eq_<  Unpacked< xs >,  s< Y... >  >
+    { };
+
+
+
+    template<  typename... X,  auto ys  >
+    requires (  packed_list<  value< ys >  >  &&  sizeof...(X) == ys.size()  )
+    struct Eq_<  s< X... >,  value< ys >  >
+    :   Eq_<  s< X... >,  Unpacked< ys >  >
+    { };
+
+
+
+    template<  typename X,  typename Y  >
+    using Eq = typename Eq_<  X,  Y  >::type;
+
+
+
+
+    template<  eval_mode mode
+            ,  typename  Lut
+            ,  typename  p
             >
-    struct Lazy_Cons_<  p,  s< q... >  >
-    :   type_hull<  s< p, q... >  >
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  eq_t,  p  >
+                >
+    :   gather<  op,  eq_t,  eager_eval<  Lut,  p  >  >
     { };
 
 
 
-    template<  typename...  p
-            ,  typename...  q
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  typename   p
+            ,  typename   q
             >
-    struct Lazy_Cons_<  lazy<p...>,  s< q... >  >
-    :   type_hull<  lazy< lazy< p... >, quoted<q>... >  >
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  op<  eq_t,  p  >,  q  >
+                >
+    :   gather<  Eq,  p,  eager_eval<  Lut,  q  >  >
     { };
 
 
 
-    template<  typename     p
-            ,  typename...  q
+
+//  ----------------------------------------------------------------------------
+//  match:
+//  ----------------------------------------------------------------------------
+//
+//  (match pattern expr) matches expr against pattern. On success the result is
+//  a library with the bindings of the pattern holes, which can be brought into
+//  scope with import:
+//
+//        ( import  ( match '( * ?T ) x )  T )
+//
+//  Pattern syntax:
+//
+//        ?x        matches any expression and binds it to x,
+//        ?xs...    as last element of a list: matches the remaining elements
+//                  (possibly none) and binds them as a list to xs,
+//        ?  ?...   anonymous holes: they match like ?x and ?xs..., but bind nothing.
+//
+//  Every other atom matches only itself, and a list matches a list elementwise.
+//  The names of the holes in a pattern must be distinct, and a rest hole anywhere
+//  but at the end of a list is an error of the pattern. If expr does not match,
+//  the result is an evaluation error, hence match can be combined with if_possible
+//  and eval_success.
+//
+//  Matching does not reduce interpreter expressions: Every level of the pattern
+//  tree is handled by one specialization that matches all elements of the level
+//  through a pack expansion.
+
+
+    template<  unsigned...  >
+    struct index_sequence {};
+
+
+#ifdef _MSC_VER
+#pragma warning( push )
+#pragma warning( disable: 4067 )
+#endif
+
+//  disable "warning C4067: unexpected tokens following preprocessor directive - expected a newline"
+//  in the #if macro below:
+
+#if defined(_MSC_VER) || __has_builtin(__make_integer_seq)
+
+#ifdef _MSC_VER
+#pragma warning( pop )
+#endif
+
+    template<  typename T,  T...  k  >
+    struct index_sequence_
+    {
+        using seq = index_sequence< k... >;
+    };
+
+
+    template<  unsigned N  >
+    using make_index_sequence  =  typename __make_integer_seq<  index_sequence_,  unsigned,  N  >::seq;
+
+#elif __has_builtin(__integer_pack)
+
+    template<  unsigned N  >
+    using make_index_sequence  =  index_sequence<  __integer_pack(N)...  >;
+
+#else
+
+    template<  unsigned N,  unsigned... k  >
+    struct make_index_sequence_
+    :   make_index_sequence_<  N-1,  N-1,  k...  >
+    { };
+
+
+    template<  unsigned... k  >
+    struct make_index_sequence_<  0,  k...  >
+    :   type_hull<  index_sequence< k... >  >
+    { };
+
+
+    template<  unsigned N  >
+    using make_index_sequence  =  typename make_index_sequence_< N >::type;
+
+#endif
+
+
+
+//  Random access to the elements of a pack through overload resolution:
+
+    template<  unsigned k,  typename X  >
+    struct numbered
+    {
+        static type_hull< X >  at_(  value< k >  );
+    };
+
+
+
+    template<  typename,  typename...  >
+    struct numbered_seq_;
+
+
+
+    template<  unsigned...  k
+            ,  typename...  X
             >
-    struct Lazy_Cons_<  p,  lazy< q... >  >
-    :   type_hull<  lazy<  quoted<p>,  q...  >  >
+    struct numbered_seq_<  index_sequence< k... >,  X...  >
+    :   numbered<  k,  X  >...
+    {
+        using numbered<  k,  X  >::at_...;
+
+
+        template<  unsigned n  >
+        using at  =  typename decltype(  at_(  value< n >{}  )  )::type;
+    };
+
+
+
+    template<  typename... X  >
+    using numbered_seq  =  numbered_seq_<  make_index_sequence< sizeof...(X) >,  X...  >;
+
+
+
+//  Holes:
+
+    enum class hole_kind {  none,  single,  rest  };
+
+
+
+    template<  typename T  >
+    static consteval hole_kind hole_kind_of(  type_hull< T >  )
+    {
+        return hole_kind::none;
+    }
+
+
+
+    template<  char... x  >
+    static consteval hole_kind hole_kind_of(  type_hull<  text< '?',  x...  >  >  )
+    {
+        constexpr char id[] = {  x...,  '\0'  };
+        constexpr unsigned n = sizeof...(x);
+
+        return  n >= 3  &&  id[n-3] == '.'  &&  id[n-2] == '.'  &&  id[n-1] == '.'
+                ?   hole_kind::rest
+                :   hole_kind::single;
+    }
+
+
+
+    template<  typename   P
+            ,  hole_kind  =  hole_kind_of(  type_hull< P >{}  )
+            >
+    struct hole_
+    {
+        static constexpr hole_kind kind = hole_kind::none;
+    };
+
+
+
+    template<  char... x  >
+    struct hole_<  text< '?',  x...  >,  hole_kind::single  >
+    {
+        static constexpr hole_kind kind = hole_kind::single;
+
+        using name = text< x... >;
+    };
+
+
+
+    template<  char... x  >
+    struct hole_<  text< '?',  x...  >,  hole_kind::rest  >
+    {
+        static constexpr hole_kind kind = hole_kind::rest;
+
+        using name =  text<>::subtext<  text<>::literal< sizeof...(x) + 1 >{  text< x... >{}  }
+                                     ,  0
+                                     ,  sizeof...(x) - 3
+                                     >;
+    };
+
+
+
+//  Bindings and failures; they are concatenated with fold expressions over +:
+
+    struct no_match
+    {
+        template<  typename T  >
+        no_match operator+(  T  ) const;
+    };
+
+
+
+    template<  typename... B  >
+    struct bindings
+    {
+        template<  typename... C  >
+        bindings<  B...,  C...  >  operator+(  bindings< C... >  ) const;
+
+
+        no_match  operator+(  no_match  ) const;
+    };
+
+
+
+    template<  typename Name,  typename X  >
+    struct binding_
+    :   type_hull<  bindings<  pair< Name, X >  >  >
     { };
 
 
 
-    template<  typename...  p
-            ,  typename...  q
+    template<  typename X  >
+    struct binding_<  text<>,  X  >
+    :   type_hull<  bindings<>  >
+    { };
+
+
+
+//  The matcher:
+
+    template<  typename P,  typename X  >
+    struct Match_Atom_
+    :   type_hull<  no_match  >
+    { };
+
+
+
+    template<  typename P  >
+    struct Match_Atom_<  P,  P  >
+    :   type_hull<  bindings<>  >
+    { };
+
+
+
+    template<  typename  P
+            ,  typename  X
+            ,  hole_kind  =  hole_< P >::kind
             >
-    struct Lazy_Cons_<  lazy< p... >,  lazy< q... >  >
-    :   type_hull<  lazy<  lazy<p...>,  q...  >  >
+    struct Match_
+    :   binding_<  typename hole_< P >::name,  X  >
     { };
 
 
 
-    template<  typename P,  typename Q  >
-    using Lazy_Cons = typename Lazy_Cons_<  P,  Q  >::type;
+    template<  typename P,  typename X  >
+    struct Match_<  P,  X,  hole_kind::none  >
+    :   Match_Atom_<  P,  X  >
+    { };
+
+
+
+    template<  typename,  typename,  typename,  typename  >
+    struct Match_Rest_;
+
+
+
+    template<  unsigned...  i
+            ,  unsigned...  j
+            ,  typename     Ps
+            ,  typename     Xs
+            >
+    struct Match_Rest_<  index_sequence< i... >,  index_sequence< j... >,  Ps,  Xs  >
+    :   type_hull<  decltype(  (  bindings<>{}
+                               +  ...
+                               +  typename Match_<  typename Ps::template at< i >
+                                                 ,  typename Xs::template at< i >
+                                                 >::type{}
+                               )
+                            +  typename binding_<  typename hole_<  typename Ps::template at< sizeof...(i) >  >::name
+                                                ,  s<  typename Xs::template at< sizeof...(i) + j >...  >
+                                                >::type{}
+                            )
+                 >
+    { };
+
+
+
+    template<  typename... P  >
+    static consteval bool ends_with_rest(  s< P... >  )
+    {
+        if constexpr (  sizeof...(P) == 0  )
+        {
+            return false;
+        }
+        else
+        {
+            return  hole_<  typename numbered_seq< P... >::template at< sizeof...(P) - 1 >  >::kind
+                    ==
+                    hole_kind::rest;
+        }
+    }
+
+
+
+    template<  typename  Ps
+            ,  typename  Xs
+            ,  bool   =  ends_with_rest(  Ps{}  )
+            >
+    struct Match_List_
+    :   type_hull<  no_match  >
+    { };
+
+
+
+    template<  typename... P,  typename... X  >
+    requires
+    (
+        sizeof...(P) == sizeof...(X)
+    )
+    struct Match_List_<  s< P... >,  s< X... >,  false  >
+    :   type_hull<  decltype(  (  bindings<>{}  +  ...  +  typename Match_< P, X >::type{}  )  )  >
+    { };
+
+
+
+    template<  typename... P,  typename... X  >
+    requires
+    (
+        sizeof...(P) <= sizeof...(X) + 1
+    )
+    struct Match_List_<  s< P... >,  s< X... >,  true  >
+    :   Match_Rest_<  make_index_sequence<  sizeof...(P) - 1  >
+                   ,  make_index_sequence<  sizeof...(X) + 1 - sizeof...(P)  >
+                   ,  numbered_seq<  P...  >
+                   ,  numbered_seq<  X...  >
+                   >
+    { };
+
+
+
+    template<  typename... P,  typename... X  >
+    struct Match_<  s< P... >,  s< X... >,  hole_kind::none  >
+    :   Match_List_<  s< P... >,  s< X... >  >
+    { };
+
+
+
+    template<  typename Bindings,  typename P,  typename X  >
+    struct Match_Result_
+    :   error_<  match_t,  P,  X  >
+    { };
+
+
+
+    template<  typename...  B
+            ,  typename     P
+            ,  typename     X
+            >
+    struct Match_Result_<  bindings< B... >,  P,  X  >
+    :   error_<  value_type<"repeated hole in match pattern: "_text>,  P  >
+    { };
+
+
+
+    template<  typename...  B
+            ,  typename     P
+            ,  typename     X
+            >
+    requires map_parameters< B... >
+    struct Match_Result_<  bindings< B... >,  P,  X  >
+    :   eval_result<  imported< B... >  >
+    { };
+
+
+
+    //  misplaced_rest( type_hull< P >{} ):  a list in P has a rest hole before its end.
+
+    template<  typename P  >
+    static consteval bool misplaced_rest(  type_hull< P >  )
+    {
+        return false;
+    }
 
 
 
-    template<  typename   Lut
-            ,  typename   p
-            ,  typename   q
-            >
-    struct eval_<  eval_mode::lazy
-                ,  Lut
-                ,  call< 0,  cons_t,  p,  q  >
-                >
-    :   gather<  Lazy_Cons,  lazy_eval< Lut, p >,  lazy_eval< Lut, q >  >
-    { };
+    template<  typename... P  >
+    static consteval bool misplaced_rest(  type_hull<  s< P... >  >  )
+    {
+        bool      misplaced  =  false;
+        unsigned  k          =  0;
 
+        (  (  misplaced  =  misplaced
+                         ||  (  ++k < sizeof...(P)  &&  hole_< P >::kind == hole_kind::rest  )
+                         ||  misplaced_rest(  type_hull< P >{}  )
+           ),  ...
+        );
 
+        return misplaced;
+    }
 
-// eager evaluation:
 
 
-    template<  typename P,  typename Q  >
-    struct Cons_
-    :   type_hull< eval_error<  cons_t,  P,  Q  >  >
+    template<  typename P,  typename X  >
+    struct Match_Pattern_
+    :   Match_Result_<  typename Match_< P, X >::type,  P,  X  >
     { };
 
 
 
-    template<  typename P,  typename... Q  >
-    struct Cons_<  P,  s< Q... >  >
-    :   type_hull<  s<  P,  Q...  >  >
+    template<  typename P,  typename X  >
+    requires (  misplaced_rest(  type_hull< P >{}  )  )
+    struct Match_Pattern_<  P,  X  >
+    :   error_<  value_type<"rest hole before the end of a match pattern: "_text>,  P  >
     { };
 
 
-    template<  typename P,  typename Q  >
-    using Cons = typename Cons_< P, Q >::type;
 
+    template<  typename P,  typename X  >
+    using Match = typename Match_Pattern_<  P,  X  >::type;
 
-    template<  typename   Lut
-            ,  typename   p
-            ,  typename   q
+
+
+    template<  eval_mode mode
+            ,  typename  Lut
+            ,  typename  p
             >
-    struct eval_<  eval_mode::eager
+    struct eval_<  mode
                 ,  Lut
-                ,  call<  0,  cons_t,  p,  q  >
+                ,  call<  0,  match_t,  p  >
                 >
-    :   gather<  Cons,  eager_eval< Lut, p >,  eager_eval< Lut, q >  >
+    :   gather<  op,  match_t,  eager_eval<  Lut,  p  >  >
     { };
 
 
 
-    template<  typename   Lut
+    template<  eval_mode  mode
+            ,  typename   Lut
             ,  typename   p
+            ,  typename   q
             >
-    struct eval_<  eval_mode::eager
+    struct eval_<  mode
                 ,  Lut
-                ,  call<  0,  cons_t,  p   >
+                ,  call<  0,  op<  match_t,  p  >,  q  >
                 >
-    :   eval_result<  op<  cons_t,  p  >  >
+    :   gather<  Match,  p,  eager_eval<  Lut,  q  >  >
     { };
 
 
 
 
 // -----------------------------------------------------------------------------
-//  rcons:
+//  text:
 // -----------------------------------------------------------------------------
+//
+//  ( text_concat x y ),  ( text_substr x begin end ),  ( text_length x ),
+//  ( text_< x y )  and  ( text_hash x )  work on the text of symbols.  The characters
+//  are processed as a char array (t<>::literal) in constant expressions and new text is
+//  built with t<>::subtext, i.e. the depth of instantiation does not depend on the
+//  length of the text.  text_< is the lexicographic order of the characters as unsigned
+//  char;  text_hash is FNV-1a, reduced to 31 bits, so that it is a non-negative integer.
 
 
-// lazy evaluation:
+    template<  typename X,  typename Y  >
+    struct Text_Concat_
+    :   type_hull<  error_<  text_concat_t,  X,  Y  >  >
+    { };
 
 
-    template<  typename P,  typename Q  >
-    struct Lazy_RCons_
-    :   type_hull<  eval_error<  rcons_t,  P,  Q  >  >
+
+    template<  char... x,  char... y  >
+    struct Text_Concat_<  text< x... >,  text< y... >  >
+    :   type_hull<  text<  x...,  y...  >  >
     { };
 
 
-    template<  typename     p
-            ,  typename...  q
+
+    template<  typename X,  typename Y  >
+    using Text_Concat  =  typename Text_Concat_< X, Y >::type;
+
+
+
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  typename   p
             >
-    struct Lazy_RCons_<  p,  s< q... >  >
-    :   type_hull<  s< q..., p >  >
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  text_concat_t,  p  >
+                >
+    :   gather<  op,  text_concat_t,  eager_eval<  Lut,  p  >  >
     { };
 
 
 
-    template<  typename...  p
-            ,  typename...  q
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  typename   p
+            ,  typename   q
             >
-    struct Lazy_RCons_<  lazy<p...>,  s< q... >  >
-    :   type_hull<  lazy<  quoted<q>...,  lazy< p... >  >  >
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  op<  text_concat_t,  p  >,  q  >
+                >
+    :   gather<  Text_Concat,  p,  eager_eval<  Lut,  q  >  >
     { };
 
 
 
-    template<  typename     p
-            ,  typename...  q
-            >
-    struct Lazy_RCons_<  p,  lazy< q... >  >
-    :   type_hull<  lazy<  q...,  quoted<p>  >  >
+    template<  typename X,  typename Begin,  typename End  >
+    struct Text_Substr_
+    :   type_hull<  error_<  text_substr_t,  X,  Begin,  End  >  >
     { };
 
 
 
-    template<  typename...  p
-            ,  typename...  q
-            >
-    struct Lazy_RCons_<  lazy< p... >,  lazy< q... >  >
-    :   type_hull<  lazy<  q...,  lazy<p...>  >  >
+    template<  char... x,  auto begin,  auto end  >
+    requires
+    (
+        std::is_integral_v<  decltype( begin )  >  &&  std::is_integral_v<  decltype( end )  >
+        &&
+        0 <= begin  &&  begin <= end  &&  end <= static_cast< long long >(  sizeof...(x)  )
+    )
+    struct Text_Substr_<  text< x... >,  value< begin >,  value< end >  >
+    :   type_hull<  t<>::subtext<  t<>::literal<  sizeof...(x) + 1  >(  text< x... >{}  ),  unsigned( begin ),  unsigned( end )  >  >
     { };
 
 
 
-    template<  typename P,  typename Q  >
-    using Lazy_RCons = typename Lazy_RCons_<  P,  Q  >::type;
+    template<  typename X,  typename Begin,  typename End  >
+    using Text_Substr  =  typename Text_Substr_< X, Begin, End >::type;
 
 
 
@@ -1968,186 +4323,152 @@ private:
             >
     struct eval_<  mode
                 ,  Lut
-                ,  call< 0,  rcons_t,  p >
+                ,  call<  0,  text_substr_t,  p  >
                 >
-    :   eval_<  mode,  Lut,  call<  1,  rcons_t,  p  >  >
+    :   gather<  op,  text_substr_t,  eager_eval<  Lut,  p  >  >
     { };
 
 
 
-    template<  typename   Lut
+    template<  eval_mode  mode
+            ,  typename   Lut
             ,  typename   p
             ,  typename   q
             >
-    struct eval_<  eval_mode::lazy
+    struct eval_<  mode
                 ,  Lut
-                ,  call< 0,  rcons_t,  p,  q  >
+                ,  call<  0,  op<  text_substr_t,  p  >,  q  >
                 >
-    :   gather<  Lazy_RCons,  lazy_eval< Lut, p >,  lazy_eval< Lut, q >  >
-    { };
-
-
-
-// eager evaluation:
-
-
-    template<  typename P,  typename Q  >
-    struct RCons_
-    :   type_hull< eval_error<  rcons_t,  P,  Q  >  >
-    { };
-
-
-
-    template<  typename P,  typename... Q  >
-    struct RCons_<  P,  s< Q... >  >
-    :   type_hull<  s<  Q...,  P  >  >
+    :   gather<  op,  text_substr_t,  p,  eager_eval<  Lut,  q  >  >
     { };
 
 
-    template<  typename P,  typename Q  >
-    using RCons = typename RCons_< P, Q >::type;
-
 
-    template<  typename   Lut
+    template<  eval_mode  mode
+            ,  typename   Lut
             ,  typename   p
             ,  typename   q
+            ,  typename   r
             >
-    struct eval_<  eval_mode::eager
+    struct eval_<  mode
                 ,  Lut
-                ,  call< 0,  rcons_t,  p,  q  >
+                ,  call<  0,  op<  text_substr_t,  p,  q  >,  r  >
                 >
-    :   gather<  RCons,  eager_eval< Lut, p >,  eager_eval< Lut, q >  >
+    :   gather<  Text_Substr,  p,  q,  eager_eval<  Lut,  r  >  >
     { };
 
 
 
-// -----------------------------------------------------------------------------
-//  count:
-// -----------------------------------------------------------------------------
-
-
     template<  typename X  >
-    struct Count
-    :   eval_error<  count_t,  X  >
-    { };
-
-
-
-    template<  typename... p  >
-    struct Count<  lazy< p... >  >
-    :   eval_result<  integer< sizeof...(p) >  >
+    struct Text_Length
+    :   error_<  text_length_t,  X  >
     { };
 
 
 
-    template<  typename... p  >
-    struct Count<  s< p... >  >
-    :   eval_result<  integer< sizeof...(p) >  >
+    template<  char... x  >
+    struct Text_Length<  text< x... >  >
+    :   eval_result<  integer<  sizeof...(x)  >  >
     { };
 
 
 
     template<  eval_mode  mode
             ,  typename   Lut
-            ,  typename   xs
+            ,  typename   p
             >
     struct eval_<  mode
                 ,  Lut
-                ,  call<  0,  count_t,  xs  >
+                ,  call<  0,  text_length_t,  p  >
                 >
-    :   Count<  lazy_eval< Lut, xs >  >
+    :   Text_Length<  eager_eval<  Lut,  p  >  >
     { };
 
 
 
-// -----------------------------------------------------------------------------
-//  apply:
-// -----------------------------------------------------------------------------
+    template<  char... x,  char... y  >
+    static consteval bool text_less_(  text< x... >,  text< y... >  )  noexcept
+    {
+        unsigned char const  a[]  =  {  static_cast< unsigned char >( x )...,  0  };
+        unsigned char const  b[]  =  {  static_cast< unsigned char >( y )...,  0  };
 
+        for ( std::size_t k = 0;  k != sizeof...(x)  &&  k != sizeof...(y);  ++k )
+            if ( a[ k ] != b[ k ] )
+                return a[ k ] < b[ k ];
 
-    template<  eval_mode mode,  typename Lut >
-    struct env_apply
-    {
-        template<   typename F,  typename Xs  >
-        struct  Apply_
-        :   eval_error<  F,  Xs  >
-        { };
+        return sizeof...(x) < sizeof...(y);
+    }
 
 
-        template<  typename F,  typename... Xs  >
-        struct Apply_<  F,  s< Xs... >  >
-        :   eval_<  mode,  Lut,  s<  F,  quoted< Xs >...  >  >
-        { };
 
+    template<  typename X,  typename Y  >
+    struct Text_Less_
+    :   type_hull<  error_<  text_less_t,  X,  Y  >  >
+    { };
 
-        template<  typename F,  typename Xs  >
-        using Apply = typename Apply_<  F,  Xs  >::type;
-    };
 
 
+    template<  char... x,  char... y  >
+    struct Text_Less_<  text< x... >,  text< y... >  >
+    :   type_hull<  value<  text_less_(  text< x... >{},  text< y... >{}  )  >  >
+    { };
 
-    template<  eval_mode    mode
-            ,  typename     Lut
-            ,  typename     f
+
+
+    template<  typename X,  typename Y  >
+    using Text_Less  =  typename Text_Less_< X, Y >::type;
+
+
+
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  typename   p
             >
     struct eval_<  mode
                 ,  Lut
-                ,  call<  0,  apply_t,  f   >
+                ,  call<  0,  text_less_t,  p  >
                 >
-    :   eval_result<  op<  apply_t,  f  >  >
+    :   gather<  op,  text_less_t,  eager_eval<  Lut,  p  >  >
     { };
 
 
 
-
-    template<  eval_mode    mode
-            ,  typename     Lut
-            ,  typename     f
-            ,  typename     xs
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  typename   p
+            ,  typename   q
             >
     struct eval_<  mode
                 ,  Lut
-                ,  call<  0,  apply_t,  f,  xs  >
+                ,  call<  0,  op<  text_less_t,  p  >,  q  >
                 >
-    :   gather<  env_apply<  mode,  Lut  >::template Apply,  f,  eager_eval< Lut, xs >  >
+    :   gather<  Text_Less,  p,  eager_eval<  Lut,  q  >  >
     { };
 
 
 
-//  ----------------------------------------------------------------------------
-//  eq:
-//  ----------------------------------------------------------------------------
+    template<  char... x  >
+    static consteval int text_hash_(  text< x... >  )  noexcept
+    {
+        std::uint32_t h = 2166136261u;
 
+        (  (  h = ( h ^ static_cast< unsigned char >( x ) ) * 16777619u  ),  ...  );
 
-    template<  typename X,  typename Y  >
-    struct Eq_
-    :   eval_result<  value< false >  >
-    { };
+        return static_cast< int >(  h & 0x7fffffffu  );
+    }
 
 
 
     template<  typename X  >
-    struct Eq_< X, X >
-    :   eval_result<  value< true >  >
+    struct Text_Hash
+    :   error_<  text_hash_t,  X  >
     { };
 
 
 
-    template<  typename X,  typename Y  >
-    using Eq = typename Eq_<  X,  Y  >::type;
-
-
-
-
-    template<  eval_mode mode
-            ,  typename  Lut
-            ,  typename  p
-            >
-    struct eval_<  mode
-                ,  Lut
-                ,  call<  0,  eq_t,  p  >
-                >
-    :   gather<  op,  eq_t,  eager_eval<  Lut,  p  >  >
+    template<  char... x  >
+    struct Text_Hash<  text< x... >  >
+    :   eval_result<  integer<  text_hash_(  text< x... >{}  )  >  >
     { };
 
 
@@ -2155,18 +4476,16 @@ private:
     template<  eval_mode  mode
             ,  typename   Lut
             ,  typename   p
-            ,  typename   q
             >
     struct eval_<  mode
                 ,  Lut
-                ,  call<  0,  op<  eq_t,  p  >,  q  >
+                ,  call<  0,  text_hash_t,  p  >
                 >
-    :   gather<  Eq,  p,  eager_eval<  Lut,  q  >  >
+    :   Text_Hash<  eager_eval<  Lut,  p  >  >
     { };
 
 
 
-
 // -----------------------------------------------------------------------------
 //  eval:
 // -----------------------------------------------------------------------------
@@ -2212,9 +4531,9 @@ private:
 
     template<  typename Erratic_Import  >
     struct Import
-    :   eval_error<  value_type<"erratic import argument"_text>
-                  ,  Erratic_Import
-                  >
+    :   error_<  value_type<"erratic import argument"_text>
+              ,  Erratic_Import
+              >
     { };
 
 
@@ -2264,7 +4583,7 @@ private:
 
     template<  typename p >
     struct Is_Atom
-    :   eval_error<  is_atom_t, p  >
+    :   error_<  is_atom_t, p  >
     { };
 
 
@@ -2276,6 +4595,14 @@ private:
 
 
 
+    template<  auto xs  >
+    requires packed_list<  value< xs >  >
+    struct Is_Atom<  value< xs >  >
+    :   eval_result<  value< false >  >
+    { };
+
+
+
     template< unsigned n,  typename f  >
     struct Is_Atom<  call< n, f >  >
     :   eval_result< value< true > >
@@ -2351,7 +4678,7 @@ private:
             ,  typename p
             >
     struct Requires
-    :   eval_error<  requires_t,  cond,  p  >
+    :   error_<  requires_t,  cond,  p  >
     { };
 
 
@@ -2391,7 +4718,7 @@ private:
 
     template<  typename B  >
     struct Not
-    :   eval_result<  eval_error<  not_t, B >  >
+    :   eval_result<  error_<  not_t, B >  >
     { };
 
 
@@ -2416,6 +4743,43 @@ private:
 
 
 
+//  ----------------------------------------------------------------------------
+//   ~:
+//  ----------------------------------------------------------------------------
+
+
+    template<  typename X  >
+    struct Bit_Not
+    :   eval_result<  error_<  bit_not_t,  X  >  >
+    { };
+
+
+
+    template<  auto x  >
+    requires
+    requires(  value<  ~x  >  )
+    {
+        nullptr;
+    }
+    struct Bit_Not<  value< x >  >
+    :   eval_result<  value<  ~x  >  >
+    { };
+
+
+
+    template<  eval_mode  mode
+            ,  typename   Lut
+            ,  typename   p
+            >
+    struct eval_<  mode
+                ,  Lut
+                ,  call<  0,  bit_not_t,  p  >
+                >
+    :   Bit_Not<  eager_eval<  Lut,  p  >  >
+    { };
+
+
+
 //  ----------------------------------------------------------------------------
 //   and:
 //  ----------------------------------------------------------------------------
@@ -2423,7 +4787,7 @@ private:
 
     template<  typename B,  typename  C  >
     struct And
-    :   eval_result<  eval_error<  and_t,  B,  C  >  >
+    :   eval_result<  error_<  and_t,  B,  C  >  >
     { };
 
 
@@ -2470,7 +4834,7 @@ private:
 
     template<  typename B,  typename  C  >
     struct Or
-    :   eval_result<  eval_error<  or_t,  B,  C >  >
+    :   eval_result<  error_<  or_t,  B,  C >  >
     { };
 
 
@@ -2516,7 +4880,7 @@ private:
 
     template<  typename B,  typename  C  >
     struct Xor
-    :   eval_result<  eval_error<  xor_t,  B,  C >  >
+    :   eval_result<  error_<  xor_t,  B,  C >  >
     { };
 
 
@@ -2567,7 +4931,7 @@ private:
 
     template<  typename cond  >
     struct If_
-    :   eval_error<  if_t,  cond  >
+    :   error_<  if_t,  cond  >
     { };
 
 
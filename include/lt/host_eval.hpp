@@ -0,0 +1,2188 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+
+
+namespace lt::host
+{
+//  A host-side interpreter of Trivium Lisp:
+//
+//  program( src ) lexes and parses src with the rules of s<>::parser (s_expr.hpp),
+//  evaluate( x ) reduces x with the rules of i<>::eval_ (eval.hpp) and cpp_type( x )
+//  spells a result as the type that lt::eval names, e.g.
+//
+//      cpp_type(  evaluate(  program( "(list 1 true)" )  )  )
+//      ==
+//      "lt::s< lt::value< 1 >, lt::value< true > >"
+//
+//  A constant program can thus be evaluated once at build time (see src/tools) instead
+//  of in every translation unit.  Terms are the types of the compile-time interpreter as
+//  trees;  the functions of interpreter correspond to its specializations one by one,
+//  including the lazy and the eager evaluation mode.  Programs that do not compile with
+//  lt::eval (ill-formed literals, unbalanced brackets, application of a value, ...)
+//  throw lt::host::error;  evaluation errors are terms of kind::error.
+//
+//  Definitions are evaluated with the Y-combinator:  results are those of lt::eval with
+//  TRIVIUM_NO_CONSTEVAL_DEF,  which differ only where a definition itself is the result.
+
+    enum class kind
+    {
+        S,  K,  Y,
+        text,                   //  t< c... >
+        value,                  //  v< x >,  x of type bool, int, unsigned, long long, unsigned long long
+        packed,                 //  v< std::array< int, n >{ ... } >
+        s,                      //  s< xs... >
+        quoted,                 //  quoted< x >
+        list,                   //  list< n >
+        op,                     //  op< f, xs... >
+        pair,                   //  pair< key, value >
+        library,                //  i< pairs... >
+        map,                    //  map< pairs... >
+        debug_output,           //  debug_output< error... >
+        call,                   //  i<>::call< n, f, xs... >        (private types of the
+        lazy,                   //  i<>::lazy< xs... >               compile-time interpreter)
+        error,                  //  i<>::eval_error< xs... >
+        class_template          //  ct< F >
+    };
+
+
+
+    using number  =  std::variant<  bool,  int,  unsigned,  long long,  unsigned long long  >;
+
+
+
+    struct node;
+
+    using term  =  std::shared_ptr<  node const  >;
+
+
+
+    struct node
+    {
+        kind                 k;
+        std::string          name     =  {};        //  text,  class_template
+        number               x        =  0;         //  value
+        std::vector< int >   ints     =  {};        //  packed
+        unsigned             n        =  0;         //  list,  call
+        std::vector< term >  xs       =  {};
+    };
+
+
+
+    struct error
+    :   std::runtime_error
+    {
+        using std::runtime_error::runtime_error;
+    };
+
+
+
+    inline term make(  kind  k,  std::vector< term >  xs = {},  unsigned  n = 0  )
+    {
+        return std::make_shared< node const >(  node{  k,  {},  0,  {},  n,  std::move( xs )  }  );
+    }
+
+
+
+    inline term make_text(  std::string_view  name  )
+    {
+        return std::make_shared< node const >(  node{  kind::text,  std::string( name )  }  );
+    }
+
+
+
+    inline term make_value(  number  x  )
+    {
+        return std::make_shared< node const >(  node{  kind::value,  {},  x  }  );
+    }
+
+
+
+    inline term make_packed(  std::vector< int >  ints  )
+    {
+        return std::make_shared< node const >(  node{  kind::packed,  {},  0,  std::move( ints )  }  );
+    }
+
+
+
+    inline bool same(  term const&  a,  term const&  b  )
+    {
+        if ( a == b )
+            return true;
+
+        if (  a->k != b->k  ||  a->name != b->name  ||  a->x != b->x  ||  a->ints != b->ints
+           ||  a->n != b->n  ||  a->xs.size() != b->xs.size()  )
+            return false;
+
+        for ( std::size_t k = 0;  k != a->xs.size();  ++k )
+            if ( ! same(  a->xs[ k ],  b->xs[ k ]  ) )
+                return false;
+
+        return true;
+    }
+
+
+
+    inline bool is_text(  term const&  x,  std::string_view  name  )
+    {
+        return  x->k == kind::text  &&  x->name == name;
+    }
+
+
+
+// -----------------------------------------------------------------------------
+//  lexer:  s<>::parser::lexer
+// -----------------------------------------------------------------------------
+
+
+    struct lexer
+    {
+        static constexpr bool is_whitespace(  char x  )
+        {
+            return  x == ' '   ||
+                    x == '\t'  ||
+                    x == '\v'  ||
+                    x == '\f'  ||
+                    x == '\r'  ||
+                    x == '\n';
+        }
+
+
+
+        static constexpr bool is_bracket(  char x  )
+        {
+            return  x  ==  '('  ||  x  ==  ')'  ||
+                    x  ==  '['  ||  x  ==  ']'  ||
+                    x  ==  '{'  ||  x  ==  '}' ;
+        }
+
+
+
+        //  the tokens of lexer::step:
+
+        static std::vector< std::string_view >  tokens(  std::string_view  src  )
+        {
+            std::vector< std::string_view >  result;
+
+            auto const  at  =  [&]( std::size_t k ) {  return  k < src.size()  ?  src[ k ]  :  '\0';  };
+
+            for ( std::size_t pos = 0;  ;  )
+            {
+                while ( at( pos ) != '\0'  &&  ( is_whitespace( at( pos ) )  ||  at( pos ) == ';' ) )
+                {
+                    if ( at( pos ) == ';' )
+                        while ( at( pos ) != '\0'  &&  at( pos ) != '\n' )
+                            ++pos;
+
+                    while ( at( pos ) != '\0'  &&  is_whitespace( at( pos ) ) )
+                        ++pos;
+                }
+
+                std::size_t  end  =  pos + 1;
+
+                switch ( at( pos ) )
+                {
+                case '\0':
+                    return result;
+
+                case '\'':  case '(':  case ')':  case '[':  case ']':  case '{':  case '}':
+                    result.push_back(  src.substr(  pos,  1  )  );
+                    pos = end;
+                    continue;
+
+                case '#':
+                    if ( at( pos + 1 ) == '(' )
+                    {
+                        end = pos + 2;
+
+                        while ( at( end ) != '\0'  &&  at( end ) != ')' )
+                            ++end;
+
+                        end += at( end ) == ')';
+
+                        result.push_back(  src.substr(  pos,  end - pos  )  );
+                        pos = end;
+                        continue;
+                    }
+                    break;
+
+                default:
+                    ;
+                }
+
+                while (  at( end ) != '\0'  &&  at( end ) != ';'  &&  ! is_whitespace( at( end ) )  &&  ! is_bracket( at( end ) )  )
+                    ++end;
+
+                result.push_back(  src.substr(  pos,  end - pos  )  );
+                pos = end;
+            }
+        }
+
+
+
+    //  sublexer:  numbers,  booleans,  packed lists and texts
+
+        static term sublexer(  std::string_view  token  )
+        {
+            if ( integer_suffix_of_( token ) != no_suffix )
+                return suffixed_integer_( token );
+
+            return sublexer_( token );
+        }
+
+
+
+    private:
+
+        static int digit_(  char d  )
+        {
+            return  '0' <= d  &&  d <= '9'  ?  d - '0'
+                 :  'a' <= d  &&  d <= 'f'  ?  d - 'a' + 10
+                 :  'A' <= d  &&  d <= 'F'  ?  d - 'A' + 10
+                 :  -1;
+        }
+
+
+
+        //  construct_number:  int arithmetic,  hence an overflow is ill-formed
+
+        static term number_(  int  base,  std::string_view  digits,  std::string_view  token  )
+        {
+            if ( digits.empty() )
+                throw error(  "number without digits:  " + std::string( token )  );
+
+            int  n  =  0;
+
+            for ( char const c : digits )
+            {
+                int const  d  =  digit_( c );
+
+                if ( d < 0  ||  d >= base )
+                    throw error(  "invalid digit in number:  " + std::string( token )  );
+
+                if ( n > ( std::numeric_limits< int >::max() - d ) / base )
+                    throw error(  "number out of range of int:  " + std::string( token )  );
+
+                n = n * base + d;
+            }
+
+            return make_value( n );
+        }
+
+
+
+        static term sublexer_(  std::string_view  token  )
+        {
+            if ( token == "true" )
+                return make_value( true );
+
+            if ( token == "false" )
+                return make_value( false );
+
+            if ( token.size() >= 2  &&  token[ 0 ] == '+' )
+                return sublexer_(  token.substr( 1 )  );
+
+            if ( token.size() >= 2  &&  token[ 0 ] == '-' )
+            {
+                term const  x  =  sublexer_(  token.substr( 1 )  );
+
+                if ( x->k != kind::value  ||  ! std::holds_alternative< int >( x->x ) )
+                    throw error(  "minus sign before a non-integer:  " + std::string( token )  );
+
+                return make_value(  - std::get< int >( x->x )  );
+            }
+
+            if ( token == "0" )
+                return make_value( 0 );
+
+            if ( token.size() >= 2  &&  token[ 0 ] == '0' )
+            {
+                switch ( token[ 1 ] )
+                {
+                case 'x':  case 'X':
+                    return number_(  16,  token.substr( 2 ),  token  );
+
+                case 'b':  case 'B':
+                    return number_(  2,  token.substr( 2 ),  token  );
+
+                default:
+                    return number_(  8,  token.substr( 1 ),  token  );
+                }
+            }
+
+            if ( ! token.empty()  &&  '1' <= token[ 0 ]  &&  token[ 0 ] <= '9' )
+                return number_(  10,  token,  token  );
+
+            if ( token.size() >= 2  &&  token[ 0 ] == '#'  &&  token[ 1 ] == '(' )
+                return packed_(  token.substr( 2 )  );
+
+            return make_text( token );
+        }
+
+
+
+    //  integer literals with a type suffix (u, ll, ull):
+
+        enum suffix_t {  no_suffix,  u_suffix,  ll_suffix,  ull_suffix  };
+
+
+
+        static char at_(  std::string_view  src,  std::size_t  k  )
+        {
+            return  k < src.size()  ?  src[ k ]  :  '\0';
+        }
+
+
+
+        static suffix_t integer_suffix_of_(  std::string_view  src  )
+        {
+            std::size_t  k  =  0;
+
+            if ( at_( src, k ) == '+'  ||  at_( src, k ) == '-' )
+                ++k;
+
+            if ( at_( src, k ) < '0'  ||  at_( src, k ) > '9' )
+                return no_suffix;
+
+            std::size_t const  n  =  src.size();
+
+            bool const  u   =  src[ n-1 ] == 'u'  ||  src[ n-1 ] == 'U';
+            bool const  ll  =  n - k >= 3  &&  (  src[ n-1 ] | 0x20  ) == 'l'  &&  (  src[ n-2 ] | 0x20  ) == 'l';
+
+            if ( ll  &&  n - k >= 4  &&  (  src[ n-3 ] | 0x20  ) == 'u' )
+                return ull_suffix;
+
+            if ( ll )
+                return ll_suffix;
+
+            if ( u  &&  n - k >= 2 )
+                return u_suffix;
+
+            return no_suffix;
+        }
+
+
+
+        static term suffixed_integer_(  std::string_view  src  )
+        {
+            auto const  fail  =  [&]( char const* what ) {  return error(  std::string( what ) + ":  " + std::string( src )  );  };
+
+            suffix_t const      suffix  =  integer_suffix_of_( src );
+            bool const          minus   =  at_( src, 0 ) == '-';
+            unsigned long long  x       =  0;
+
+            std::size_t  k  =  minus  ||  at_( src, 0 ) == '+';
+
+            int          base    =  10;
+            unsigned     digits  =  0;
+
+            if ( at_( src, k ) == '0' )
+            {
+                ++k;
+                ++digits;
+                base = 8;
+
+                if ( at_( src, k ) == 'x'  ||  at_( src, k ) == 'X' )
+                    base = 16;
+                else if ( at_( src, k ) == 'b'  ||  at_( src, k ) == 'B' )
+                    base = 2;
+
+                if ( base != 8 )
+                {
+                    ++k;
+                    digits = 0;
+                }
+            }
+
+            for ( ;  at_( src, k ) != 'u'  &&  at_( src, k ) != 'U'  &&  at_( src, k ) != 'l'  &&  at_( src, k ) != 'L';  ++k,  ++digits )
+            {
+                int const  d  =  digit_(  at_( src, k )  );
+
+                if ( d < 0  ||  d >= base )
+                    throw fail( "integer literal:  invalid digit" );
+
+                if ( x > ( ~0ull - d ) / base )
+                    throw fail( "integer literal:  number out of range of unsigned long long" );
+
+                x = x * base + d;
+            }
+
+            if ( digits == 0 )
+                throw fail( "integer literal:  number expected" );
+
+            if ( k + suffix != src.size() )                 // the length of the suffix is suffix
+                throw fail( "integer literal:  invalid suffix" );
+
+            if ( minus  &&  suffix != ll_suffix )
+                throw fail( "integer literal:  unsigned number with minus sign" );
+
+            if ( suffix == u_suffix  &&  x > 0xffffffffull )
+                throw fail( "integer literal:  number out of range of unsigned" );
+
+            if ( suffix == ll_suffix  &&  x > 0x7fffffffffffffffull + minus )
+                throw fail( "integer literal:  number out of range of long long" );
+
+            if ( suffix == u_suffix )
+                return make_value(  static_cast< unsigned >( x )  );
+
+            if ( suffix == ll_suffix )
+                return make_value(  static_cast< long long >(  minus  ?  0ull - x  :  x  )  );
+
+            return make_value( x );
+        }
+
+
+
+    //  packed lists #( num ... ),  src is the token without "#(":
+
+        static term packed_(  std::string_view  src  )
+        {
+            auto const  fail  =  [&]( char const* what ) {  return error(  std::string( what ) + ":  #(" + std::string( src )  );  };
+
+            std::vector< int >  xs;
+
+            for ( std::size_t k = 0;  ;  )
+            {
+                while ( is_whitespace( at_( src, k ) ) )
+                    ++k;
+
+                if ( at_( src, k ) == '\0' )
+                    throw fail( "#( ... ):  missing closing bracket" );
+
+                if ( at_( src, k ) == ')' )
+                {
+                    if ( k + 1 != src.size() )
+                        throw fail( "#( ... ):  unexpected characters after closing bracket" );
+
+                    return  xs.empty()  ?  make( kind::s )  :  make_packed(  std::move( xs )  );
+                }
+
+                bool const  minus  =  at_( src, k ) == '-';
+
+                if ( at_( src, k ) == '-'  ||  at_( src, k ) == '+' )
+                    ++k;
+
+                int       base    =  10;
+                unsigned  digits  =  0;
+
+                if ( at_( src, k ) == '0' )
+                {
+                    ++k;
+                    ++digits;
+                    base = 8;
+
+                    if ( at_( src, k ) == 'x'  ||  at_( src, k ) == 'X' )
+                        base = 16;
+                    else if ( at_( src, k ) == 'b'  ||  at_( src, k ) == 'B' )
+                        base = 2;
+
+                    if ( base != 8 )
+                    {
+                        ++k;
+                        digits = 0;
+                    }
+                }
+
+                long long  x  =  0;
+
+                for ( ;  at_( src, k ) != '\0'  &&  at_( src, k ) != ')'  &&  ! is_whitespace( at_( src, k ) );  ++k,  ++digits )
+                {
+                    int const  d  =  digit_(  at_( src, k )  );
+
+                    if ( d < 0  ||  d >= base )
+                        throw fail( "#( ... ):  invalid digit" );
+
+                    x = x * base + d;
+
+                    if ( x > 0x80000000ll )
+                        throw fail( "#( ... ):  number out of range of int" );
+                }
+
+                if ( digits == 0 )
+                    throw fail( "#( ... ):  number expected" );
+
+                if ( ! minus  &&  x == 0x80000000ll )
+                    throw fail( "#( ... ):  number out of range of int" );
+
+                xs.push_back(  static_cast< int >(  minus  ?  -x  :  x  )  );
+            }
+        }
+    };
+
+
+
+// -----------------------------------------------------------------------------
+//  parser:  s<>::parser::parser_  and  application<>  (s_types.hpp)
+// -----------------------------------------------------------------------------
+
+
+    class parser
+    {
+        std::vector< term >  tokens_;
+        std::size_t          pos_  =  0;
+
+
+
+        static bool is_opening_(  term const&  x  )
+        {
+            return  is_text( x, "(" )  ||  is_text( x, "[" )  ||  is_text( x, "{" );
+        }
+
+
+
+        static char closing_(  term const&  opening  )
+        {
+            return  is_text( opening, "(" )  ?  ')'
+                 :  is_text( opening, "[" )  ?  ']'
+                 :                              '}';
+        }
+
+
+
+        //  parser_< stack<>,  input< ... > >:
+
+        term expression_()
+        {
+            if ( pos_ == tokens_.size() )
+                throw error( "unexpected end of the program" );
+
+            term const  x  =  tokens_[ pos_++ ];
+
+            if ( is_text( x, "'" )  &&  pos_ != tokens_.size() )
+                return make(  kind::quoted,  {  expression_()  }  );
+
+            if ( is_opening_( x ) )
+                return bracket_( x );
+
+            return x;
+        }
+
+
+
+        //  parser_< stack< opening_bracket,  Ys... >,  input< ... > >:
+
+        term bracket_(  term const&  opening  )
+        {
+            std::vector< term >  ys;
+
+            for ( ;; )
+            {
+                if ( pos_ == tokens_.size() )
+                    throw error(  "missing closing bracket for " + opening->name  );
+
+                term const&  x  =  tokens_[ pos_ ];
+
+                if ( is_text(  x,  std::string_view(  std::string( 1, closing_( opening ) )  )  ) )
+                {
+                    ++pos_;
+                    break;
+                }
+
+                if (  ( is_text( x, "'" )  &&  pos_ + 1 != tokens_.size() )  ||  is_opening_( x )  )
+                {
+                    ys.push_back(  expression_()  );
+                }
+                else
+                {
+                    ys.push_back( x );
+                    ++pos_;
+                }
+            }
+
+            switch ( closing_( opening ) )
+            {
+            case ')':
+                if ( ! ys.empty()  &&  is_text( ys[ 0 ], "list" ) )
+                {
+                    if ( ys.size() == 1 )
+                        return make( kind::s );
+
+                    ys[ 0 ] = make(  kind::list,  {},  unsigned(  ys.size() - 1  )  );
+                }
+
+                if ( ys.size() == 2  &&  is_text( ys[ 0 ], "quote" ) )
+                    return make(  kind::quoted,  {  ys[ 1 ]  }  );
+
+                return make(  kind::s,  std::move( ys )  );
+
+            case ']':
+                return abstraction(  ys,  expression_()  );
+
+            default:
+                return right_assoc_( ys,  0 );
+            }
+        }
+
+
+
+        //  { x1 ... xn } ->  x1 ( x2 ( x3 ( ... (x_{n-1} x_n) ... ) ))
+
+        static term right_assoc_(  std::vector< term > const&  ys,  std::size_t  k  )
+        {
+            if ( ys.size() - k <= 2 )
+                return make(  kind::s,  std::vector< term >(  ys.begin() + k,  ys.end()  )  );
+
+            return make(  kind::s,  {  ys[ k ],  right_assoc_(  ys,  k + 1  )  }  );
+        }
+
+
+
+    //  Bracket abstraction  [ x ] expr  with the rules of application<>::ap_ and combine_:
+
+        static term combine_(  term const&  p,  term const&  q  )
+        {
+            auto const  is_k_  =  [](  term const&  x  )
+            {
+                return  x->k == kind::s  &&  x->xs.size() == 2  &&  x->xs[ 0 ]->k == kind::K;
+            };
+
+            bool const  q_is_i  =  q->k == kind::s  &&  q->xs.size() == 3  &&  q->xs[ 0 ]->k == kind::S
+                                   &&  q->xs[ 1 ]->k == kind::K  &&  q->xs[ 2 ]->k == kind::K;
+
+            if ( is_k_( p )  &&  is_k_( q ) )
+            {
+                term const&  pp  =  p->xs[ 1 ];
+
+                if ( pp->k == kind::s  &&  ! pp->xs.empty() )
+                {
+                    std::vector< term >  xs  =  pp->xs;
+                    xs.push_back(  q->xs[ 1 ]  );
+
+                    return make(  kind::s,  {  p->xs[ 0 ],  make(  kind::s,  std::move( xs )  )  }  );
+                }
+
+                return make(  kind::s,  {  p->xs[ 0 ],  make(  kind::s,  {  pp,  q->xs[ 1 ]  }  )  }  );
+            }
+
+            if ( is_k_( p )  &&  q_is_i )
+                return p->xs[ 1 ];
+
+            return make(  kind::s,  {  make( kind::S ),  p,  q  }  );
+        }
+
+
+
+        static term abstract_(  std::string const&  x,  term const&  expr  );
+
+
+
+        //  the application ( e[0] ... e[m-1] ):
+
+        static term abstract_application_(  std::string const&  x,  std::vector< term > const&  e,  std::size_t  m  )
+        {
+            term const  f  =  m == 2  ?  abstract_(  x,  e[ 0 ]  )
+                                      :  abstract_application_(  x,  e,  m - 1  );
+
+            return combine_(  f,  abstract_(  x,  e[ m - 1 ]  )  );
+        }
+
+
+
+    public:
+
+        explicit parser(  std::string_view  src  )
+        {
+            for ( std::string_view const  token : lexer::tokens( src ) )
+                tokens_.push_back(  lexer::sublexer( token )  );
+        }
+
+
+
+        term run()
+        {
+            term const  x  =  expression_();
+
+            if ( pos_ != tokens_.size() )
+                throw error( "the program is not a single expression" );
+
+            return x;
+        }
+
+
+
+        //  application<  xs...  >::apply_to<  expr  >:
+
+        static term abstraction(  std::vector< term > const&  xs,  term  expr  )
+        {
+            if ( xs.empty() )
+                throw error( "[ ] without variables" );
+
+            for ( term const&  x : xs )
+                if ( x->k != kind::text )
+                    throw error( "a variable of [ ... ] is not a symbol" );
+
+            for ( std::size_t k = xs.size();  k-- != 0;  )
+                expr = abstract_(  xs[ k ]->name,  expr  );
+
+            return expr;
+        }
+    };
+
+
+
+    inline term parser::abstract_(  std::string const&  x,  term const&  expr  )
+    {
+        if ( expr->k == kind::s  &&  expr->xs.size() == 1 )
+            throw error(  "Forbidden nullary function call. No user-defined function f "
+                          "may be called without arguments via the expression (f)."  );
+
+        if ( expr->k == kind::s  &&  expr->xs.size() > 1 )
+            return abstract_application_(  x,  expr->xs,  expr->xs.size()  );
+
+        if ( is_text( expr, x ) )
+            return make(  kind::s,  {  make( kind::S ),  make( kind::K ),  make( kind::K )  }  );
+
+        return make(  kind::s,  {  make( kind::K ),  expr  }  );
+    }
+
+
+
+    inline term program(  std::string_view  src  )
+    {
+        return parser( src ).run();
+    }
+
+
+
+// -----------------------------------------------------------------------------
+//  interpreter:  i<>::eval_
+// -----------------------------------------------------------------------------
+
+
+    class interpreter
+    {
+    public:
+
+        enum class mode {  lazy,  eager  };
+
+
+
+        //  the look-up table:  the latest binding of a key wins,  export lists the keys in the
+        //  order of their first binding (as map<>::add_or_replace)
+
+        struct binding
+        {
+            std::string                       key;
+            term                              value;
+            std::shared_ptr< binding const >  next;
+        };
+
+        using lut  =  std::shared_ptr< binding const >;
+
+
+
+        term eval(  mode  m,  lut  env,  term  x  );
+
+
+
+        term eager_eval(  lut const&  env,  term const&  x  )  {  return eval(  mode::eager,  env,  x  );  }
+
+        term lazy_eval(  lut const&  env,  term const&  x  )   {  return eval(  mode::lazy,  env,  x  );  }
+
+
+
+    private:
+
+        //  The compiler instantiates eval_< mode, Lut, T > once per type,  so arguments that
+        //  combinators duplicate are reduced only once.  memo_ does the same for the nodes
+        //  of a term:  it maps ( mode, env, node ) of every step of an evaluation to the
+        //  result and keeps node and env alive,  so that their addresses are not reused.
+
+        struct memo_key
+        {
+            mode             m;
+            binding const*   env;
+            node const*      x;
+
+            bool operator==(  memo_key const&  ) const = default;
+        };
+
+
+
+        struct memo_hash
+        {
+            std::size_t operator()(  memo_key const&  k  ) const noexcept
+            {
+                std::size_t const  a  =  reinterpret_cast< std::uintptr_t >( k.env );
+                std::size_t const  b  =  reinterpret_cast< std::uintptr_t >( k.x );
+
+                return  ( a * 0x9e3779b97f4a7c15ull )  ^  b  ^  std::size_t( k.m );
+            }
+        };
+
+
+
+        struct memo_entry
+        {
+            term  x;
+            lut   env;
+            term  result;
+        };
+
+
+
+        std::unordered_map<  memo_key,  memo_entry,  memo_hash  >  memo_;
+
+
+
+        //  an evaluation step either has a result or continues with tail in env (as the
+        //  specializations that derive from eval_< mode,  Lut,  ...  >)
+
+        struct step
+        {
+            term  result;
+            term  tail    =  nullptr;
+            lut   env     =  nullptr;
+        };
+
+
+
+        static term error_(  std::vector< term >  xs  )  {  return make(  kind::error,  std::move( xs )  );  }
+
+        static term text_(  std::string_view  name  )     {  return make_text( name );  }
+
+        static term quoted_(  term const&  x  )           {  return make(  kind::quoted,  {  x  }  );  }
+
+        static term call_(  unsigned  n,  std::vector< term >  xs  )  {  return make(  kind::call,  std::move( xs ),  n  );  }
+
+
+
+        static bool is_error_(  term const&  x  )  {  return x->k == kind::error;  }
+
+        static bool is_bool_(  term const&  x  )   {  return x->k == kind::value  &&  std::holds_alternative< bool >( x->x );  }
+
+        static bool is_int_(  term const&  x  )    {  return x->k == kind::value  &&  std::holds_alternative< int >( x->x );  }
+
+
+
+        //  gather< F, xs... >:  an error,  if one of xs is an error
+
+        template<  typename Build  >
+        static term gather_(  char const*  f,  std::vector< term > const&  xs,  Build  build  )
+        {
+            for ( term const&  x : xs )
+                if ( is_error_( x ) )
+                {
+                    std::vector< term >  ys {  std::make_shared< node const >(  node{  kind::class_template,  f  }  )  };
+                    ys.insert(  ys.end(),  xs.begin(),  xs.end()  );
+
+                    return error_(  std::move( ys )  );
+                }
+
+            return build( xs );
+        }
+
+
+
+        static term s_(  std::vector< term > const&  xs  )
+        {
+            return gather_(  "s",  xs,  [](  auto const& ys  ) {  return make(  kind::s,  ys  );  }  );
+        }
+
+
+
+        static term op_(  std::vector< term > const&  xs  )
+        {
+            return gather_(  "op",  xs,  [](  auto const& ys  ) {  return make(  kind::op,  ys  );  }  );
+        }
+
+
+
+        static term unpacked_(  term const&  xs  )
+        {
+            std::vector< term >  ys;
+
+            for ( int const  x : xs->ints )
+                ys.push_back(  make_value( x )  );
+
+            return make(  kind::s,  std::move( ys )  );
+        }
+
+
+
+        static lut add_(  lut  env,  std::string const&  key,  term const&  value  )
+        {
+            return std::make_shared< binding const >(  binding{  key,  value,  std::move( env )  }  );
+        }
+
+
+
+        static term lookup_(  lut const&  env,  term const&  x  )
+        {
+            if ( x->k == kind::text )
+                for ( binding const* b = env.get();  b != nullptr;  b = b->next.get() )
+                    if ( b->key == x->name )
+                        return b->value;
+
+            return error_(  {  x  }  );
+        }
+
+
+
+        static std::vector< term >  pairs_(  lut const&  env  )
+        {
+            std::vector< binding const* >  bindings;
+
+            for ( binding const* b = env.get();  b != nullptr;  b = b->next.get() )
+                bindings.push_back( b );
+
+            std::vector< term >  pairs;
+
+            for ( std::size_t k = bindings.size();  k-- != 0;  )
+            {
+                term const  p  =  make(  kind::pair,  {  text_( bindings[ k ]->key ),  bindings[ k ]->value  }  );
+                bool        replaced  =  false;
+
+                for ( term&  q : pairs )
+                    if ( q->xs[ 0 ]->name == bindings[ k ]->key )
+                    {
+                        q = p;
+                        replaced = true;
+                    }
+
+                if ( ! replaced )
+                    pairs.push_back( p );
+            }
+
+            return pairs;
+        }
+
+
+
+    //  keywords and operators:
+
+        static bool is_bin_op_(  std::string_view  f  )
+        {
+            for ( std::string_view const  g : {  "<=",  "!=",  "==",  ">=",  "<",  ">",  "+",  "-",  "*",  "/",  "%"
+                                              ,  "wrap_+",  "wrap_-",  "wrap_*",  "&",  "|",  "^",  "<<",  ">>"  } )
+                if ( f == g )
+                    return true;
+
+            return false;
+        }
+
+
+
+        static bool is_keyword_(  std::string_view  f  )
+        {
+            for ( std::string_view const  g : {  "apply",  "and",  "~",  "cons",  "count",  "def",  "drop_first"
+                                              ,  "eval_success",  "eval",  "eq",  "first",  "fold",  "if"
+                                              ,  "if_possible",  "import",  "is_atom",  "is_integral",  "match"
+                                              ,  "not",  "or",  "pack",  "raise_error",  "rcons",  "requires"
+                                              ,  "show_error",  "text_concat",  "text_hash",  "text_length"
+                                              ,  "text_<",  "text_substr",  "unpack",  "xor"  } )
+                if ( f == g )
+                    return true;
+
+            return false;
+        }
+
+
+
+        //  op< f, xs... > with an explicit  eval_< mode, Lut, op< f, xs... > >  ->  call< 1, f, xs... >
+
+        static bool is_curried_(  term const&  f  )
+        {
+            if ( f->k == kind::S  ||  f->k == kind::K  ||  f->k == kind::Y )
+                return true;
+
+            if ( f->k != kind::text )
+                return false;
+
+            return  f->name == "apply"  ||  f->name == "and"  ||  f->name == "or"  ||  f->name == "xor"
+                ||  f->name == "cons"   ||  f->name == "rcons"  ||  is_bin_op_( f->name );
+        }
+
+
+
+        static term bin_op_(  std::string const&  f,  term const&  x,  term const&  y  );
+
+        step step_(  mode  m,  lut const&  env,  term const&  x  );
+
+        term fold_(  mode  m,  lut const&  env,  term const&  f,  term  init,  term  xs  );
+
+        static term match_(  term const&  p,  term const&  x  );
+
+        static term text_substr_(  term const&  x,  term const&  begin,  term const&  end  );
+
+        step keyword_(  mode  m,  lut const&  env,  term const&  x  );
+
+        step partial_(  mode  m,  lut const&  env,  term const&  x  );
+
+        step call_0_(  mode  m,  lut const&  env,  term const&  x  );
+
+        step application_(  mode  m,  lut const&  env,  term const&  x  );
+    };
+
+
+
+// -----------------------------------------------------------------------------
+//  The evaluator:
+// -----------------------------------------------------------------------------
+
+
+    inline term interpreter::eval(  mode  m,  lut  env,  term  x  )
+    {
+        std::vector< std::pair< memo_key, memo_entry > >  steps;
+
+        term  result;
+
+        for ( ;; )
+        {
+            memo_key const  key {  m,  env.get(),  x.get()  };
+
+            if ( auto const  hit  =  memo_.find( key );  hit != memo_.end() )
+            {
+                result = hit->second.result;
+                break;
+            }
+
+            step  r  =  step_(  m,  env,  x  );
+
+            steps.push_back(  {  key,  memo_entry{  x,  env,  nullptr  }  }  );
+
+            if ( r.tail == nullptr )
+            {
+                result = std::move( r.result );
+                break;
+            }
+
+            x = std::move( r.tail );
+
+            if ( r.env != nullptr )
+                env = std::move( r.env );
+        }
+
+        for ( auto&  [ key, entry ] : steps )
+        {
+            entry.result = result;
+            memo_.emplace(  key,  std::move( entry )  );
+        }
+
+        return result;
+    }
+
+
+
+    inline interpreter::step interpreter::step_(  mode  m,  lut const&  env,  term const&  x  )
+    {
+        switch ( x->k )
+        {
+        case kind::quoted:
+            return {  x->xs[ 0 ]  };
+
+        case kind::error:
+        case kind::value:
+        case kind::packed:
+            return {  x  };
+
+        case kind::S:
+        case kind::K:
+        case kind::Y:
+            return {  call_(  1,  {  x  }  )  };
+
+        case kind::list:
+            return {  call_(  x->n,  {  x  }  )  };
+
+        case kind::lazy:
+        {
+            if ( m == mode::lazy )
+                return {  x  };
+
+            std::vector< term >  ys;
+
+            for ( term const&  p : x->xs )
+                ys.push_back(  eager_eval(  env,  p  )  );
+
+            return {  s_( ys )  };
+        }
+
+        case kind::text:
+            if ( x->name == "export" )
+                return {  make(  kind::library,  pairs_( env )  )  };
+
+            if ( is_keyword_( x->name )  ||  is_bin_op_( x->name ) )
+                return {  call_(  1,  {  x  }  )  };
+
+            return {  lookup_(  env,  x  )  };
+
+        case kind::op:
+            if ( is_curried_(  x->xs[ 0 ]  ) )
+                return {  call_(  1,  x->xs  )  };
+
+            return {  call_(  1,  {  x  }  )  };
+
+        case kind::call:
+            if ( x->n != 0 )
+                return {  x  };
+
+            return call_0_(  m,  env,  x  );
+
+        case kind::s:
+            if ( x->xs.empty() )
+                return {  x  };
+
+            return application_(  m,  env,  x  );
+
+        default:
+            return {  lookup_(  env,  x  )  };
+        }
+    }
+
+
+
+//  s< f, args... >:  the head is evaluated eagerly,  calls collect their arguments
+
+    inline interpreter::step interpreter::application_(  mode,  lut const&  env,  term const&  x  )
+    {
+        term const&                 f     =  x->xs[ 0 ];
+        std::vector< term > const&  args  =  x->xs;
+
+        if ( is_error_( f ) )
+            return {  error_( args )  };
+
+        if ( f->k == kind::call  &&  args.size() == 1 )
+            return {  nullptr,  f  };
+
+        if ( f->k == kind::call  &&  f->n != 0 )
+        {
+            std::vector< term >  p  =  f->xs;
+            p.push_back(  args[ 1 ]  );
+
+            term const  g  =  call_(  f->n - 1,  std::move( p )  );
+
+            if ( is_error_(  args[ 1 ]  ) )
+            {
+                std::vector< term >  ys {  g  };
+                ys.insert(  ys.end(),  args.begin() + 2,  args.end()  );
+
+                return {  error_(  std::move( ys )  )  };
+            }
+
+            if ( args.size() == 2 )
+                return {  nullptr,  g  };
+
+            std::vector< term >  ys {  g  };
+            ys.insert(  ys.end(),  args.begin() + 2,  args.end()  );
+
+            return {  nullptr,  make(  kind::s,  std::move( ys )  )  };
+        }
+
+        if ( f->k == kind::call  &&  f->xs[ 0 ]->k == kind::list )           // excess arguments
+            return {  error_( args )  };
+
+        term const  g  =  eager_eval(  env,  f  );
+
+        if ( same(  f,  g  ) )
+            throw error( "application of a value that is no function" );
+
+        std::vector< term >  ys  =  args;
+        ys[ 0 ] = g;
+
+        return {  nullptr,  make(  kind::s,  std::move( ys )  )  };
+    }
+
+
+
+//  call< 0,  f,  p... >:
+
+    inline interpreter::step interpreter::call_0_(  mode  m,  lut const&  env,  term const&  x  )
+    {
+        term const&        f  =  x->xs[ 0 ];
+        std::size_t const  n  =  x->xs.size() - 1;
+
+        auto const  arg  =  [&](  std::size_t k  )  ->  term const&  {  return x->xs[ k + 1 ];  };
+
+        switch ( f->k )
+        {
+        case kind::S:
+            if ( n == 3 )
+                return {  nullptr,  make(  kind::s,  {  arg( 0 ),  arg( 2 ),  make(  kind::s,  {  arg( 1 ),  arg( 2 )  }  )  }  )  };
+
+            return {  make(  kind::op,  x->xs  )  };
+
+        case kind::K:
+            if ( n == 2 )
+                return {  nullptr,  arg( 0 )  };
+
+            return {  make(  kind::op,  x->xs  )  };
+
+        case kind::Y:
+            if ( n == 2 )
+                return {  nullptr,  make(  kind::s,  {  arg( 0 ),  make(  kind::s,  {  f,  arg( 0 )  }  ),  arg( 1 )  }  )  };
+
+            return {  make(  kind::op,  x->xs  )  };
+
+        case kind::list:
+        {
+            std::vector< term >  ys(  x->xs.begin() + 1,  x->xs.end()  );
+
+            if ( m == mode::lazy )
+                return {  gather_(  "lazy",  ys,  [](  auto const& zs  ) {  return make(  kind::lazy,  zs  );  }  )  };
+
+            for ( term&  y : ys )
+                y = eager_eval(  env,  y  );
+
+            return {  s_( ys )  };
+        }
+
+        case kind::text:
+            return keyword_(  m,  env,  x  );
+
+        case kind::op:
+            return partial_(  m,  env,  x  );
+
+        default:
+            return {  lookup_(  env,  x  )  };
+        }
+    }
+
+
+
+//  call< 0,  keyword,  p... >:
+
+    inline interpreter::step interpreter::keyword_(  mode  m,  lut const&  env,  term const&  x  )
+    {
+        term const&         f  =  x->xs[ 0 ];
+        std::string const&  k  =  f->name;
+        std::size_t const   n  =  x->xs.size() - 1;
+        term const&         p  =  x->xs[ 1 ];
+
+        auto const  op  =  [&](  std::vector< term > const&  xs  ) {  return step{  op_( xs )  };  };
+
+        if ( is_bin_op_( k ) )
+        {
+            if ( n == 1 )
+                return {  call_(  1,  x->xs  )  };
+
+            return {  bin_op_(  k,  eager_eval( env, p ),  eager_eval(  env,  x->xs[ 2 ]  )  )  };
+        }
+
+        if ( k == "def" )
+        {
+            term const  g  =  eager_eval(  env,  p  );
+
+            if ( g->k != kind::text )
+                return {  error_(  {  text_( "unusable left-hand side in def: " ),  g  }  )  };
+
+            return {  make(  kind::op,  {  f,  g  }  )  };
+        }
+
+        if ( k == "apply" )
+        {
+            if ( n == 1 )
+                return {  make(  kind::op,  x->xs  )  };
+
+            term const  xs  =  eager_eval(  env,  x->xs[ 2 ]  );
+
+            if ( is_error_( p )  ||  is_error_( xs ) )
+                return {  gather_(  "Apply",  {  p,  xs  },  [](  auto const&  ) {  return term{};  }  )  };
+
+            if ( xs->k != kind::s )
+                return {  error_(  {  p,  xs  }  )  };
+
+            std::vector< term >  ys {  p  };
+
+            for ( term const&  y : xs->xs )
+                ys.push_back(  quoted_( y )  );
+
+            return {  nullptr,  make(  kind::s,  std::move( ys )  )  };
+        }
+
+        if ( k == "and"  ||  k == "or"  ||  k == "xor" )
+        {
+            if ( n == 1 )
+                return {  make(  kind::op,  x->xs  )  };
+
+            term const  a  =  eager_eval(  env,  p  );
+            term const  b  =  eager_eval(  env,  x->xs[ 2 ]  );
+
+            if ( ! is_bool_( a )  ||  ! is_bool_( b ) )
+                return {  error_(  {  f,  a,  b  }  )  };
+
+            bool const  u  =  std::get< bool >( a->x );
+            bool const  v  =  std::get< bool >( b->x );
+
+            return {  make_value(  k == "and"  ?  u && v  :  k == "or"  ?  u || v  :  ! ( u == v )  )  };
+        }
+
+        if ( k == "cons"  ||  k == "rcons" )
+        {
+            bool const  r  =  k == "rcons";
+
+            if ( n == 1 )
+            {
+                if ( r )
+                    return {  call_(  1,  x->xs  )  };
+
+                if ( m == mode::eager )
+                    return {  make(  kind::op,  x->xs  )  };
+
+                return {  lookup_(  env,  x  )  };
+            }
+
+            term        a  =  eval(  m,  env,  p  );
+            term        b  =  eval(  m,  env,  x->xs[ 2 ]  );
+
+            if ( is_error_( a )  ||  is_error_( b ) )
+                return {  gather_(  r ? "RCons" : "Cons",  {  a,  b  },  [](  auto const&  ) {  return term{};  }  )  };
+
+            if ( b->k == kind::packed  &&  is_int_( a ) )
+            {
+                std::vector< int >  ys  =  b->ints;
+                ys.insert(  r ? ys.end() : ys.begin(),  std::get< int >( a->x )  );
+
+                return {  make_packed(  std::move( ys )  )  };
+            }
+
+            if ( b->k == kind::packed )
+                b = unpacked_( b );
+
+            std::vector< term >  ys;
+
+            if ( m == mode::lazy  &&  ( a->k == kind::lazy  ||  b->k == kind::lazy ) )
+            {
+                if ( b->k != kind::s  &&  b->k != kind::lazy )
+                    return {  error_(  {  f,  a,  b  }  )  };
+
+                for ( term const&  y : b->xs )
+                    ys.push_back(  b->k == kind::s  ?  quoted_( y )  :  y  );
+
+                term const  z  =  a->k == kind::lazy  ?  a  :  quoted_( a );
+                ys.insert(  r ? ys.end() : ys.begin(),  z  );
+
+                return {  make(  kind::lazy,  std::move( ys )  )  };
+            }
+
+            if ( b->k != kind::s )
+                return {  error_(  {  f,  a,  b  }  )  };
+
+            ys = b->xs;
+            ys.insert(  r ? ys.end() : ys.begin(),  a  );
+
+            return {  make(  kind::s,  std::move( ys )  )  };
+        }
+
+        if ( k == "count" )
+        {
+            term const  xs  =  lazy_eval(  env,  p  );
+
+            if ( xs->k == kind::s  ||  xs->k == kind::lazy )
+                return {  make_value(  int( xs->xs.size() )  )  };
+
+            if ( xs->k == kind::packed )
+                return {  make_value(  int( xs->ints.size() )  )  };
+
+            return {  error_(  {  f,  xs  }  )  };
+        }
+
+        if ( k == "first" )
+        {
+            term const  xs  =  lazy_eval(  env,  p  );
+
+            if ( xs->k == kind::s  &&  ! xs->xs.empty() )
+                return {  xs->xs[ 0 ]  };
+
+            if ( xs->k == kind::packed )
+                return {  make_value(  xs->ints[ 0 ]  )  };
+
+            if ( xs->k == kind::lazy  &&  ! xs->xs.empty() )
+                return {  nullptr,  xs->xs[ 0 ]  };
+
+            return {  error_(  {  f,  xs  }  )  };
+        }
+
+        if ( k == "drop_first" )
+        {
+            term const  xs  =  lazy_eval(  env,  p  );
+
+            if ( xs->k == kind::packed )
+                return {   xs->ints.size() == 1  ?  make( kind::s )
+                                                 :  make_packed(  std::vector< int >(  xs->ints.begin() + 1,  xs->ints.end()  )  )  };
+
+            if (  ( xs->k != kind::s  &&  xs->k != kind::lazy )  ||  xs->xs.empty()  )
+                throw error( "drop_first of an empty list or an atom" );
+
+            std::vector< term >  ys(  xs->xs.begin() + 1,  xs->xs.end()  );
+
+            if ( xs->k == kind::s )
+                return {  make(  kind::s,  std::move( ys )  )  };
+
+            if ( m == mode::lazy )
+                return {  make(  kind::lazy,  std::move( ys )  )  };
+
+            for ( term&  y : ys )
+                y = eager_eval(  env,  y  );
+
+            return {  s_( ys )  };
+        }
+
+        if ( k == "pack" )
+        {
+            term const  xs  =  eager_eval(  env,  p  );
+
+            if ( xs->k == kind::packed  ||  ( xs->k == kind::s  &&  xs->xs.empty() ) )
+                return {  xs  };
+
+            std::vector< int >  ys;
+
+            if ( xs->k == kind::s )
+                for ( term const&  y : xs->xs )
+                    if ( is_int_( y ) )
+                        ys.push_back(  std::get< int >( y->x )  );
+
+            if ( xs->k != kind::s  ||  ys.size() != xs->xs.size() )
+                return {  error_(  {  f,  xs  }  )  };
+
+            return {  make_packed(  std::move( ys )  )  };
+        }
+
+        if ( k == "unpack" )
+        {
+            term const  xs  =  eager_eval(  env,  p  );
+
+            if ( xs->k == kind::s )
+                return {  xs  };
+
+            if ( xs->k == kind::packed )
+                return {  unpacked_( xs )  };
+
+            return {  error_(  {  f,  xs  }  )  };
+        }
+
+        if ( k == "fold"  ||  k == "eq"  ||  k == "match"  ||  k == "text_concat"  ||  k == "text_<"  ||  k == "text_substr" )
+            return op(  {  f,  eager_eval( env, p )  }  );
+
+        if ( k == "text_length"  ||  k == "text_hash" )
+        {
+            term const  t  =  eager_eval(  env,  p  );
+
+            if ( t->k != kind::text )
+                return {  error_(  {  f,  t  }  )  };
+
+            if ( k == "text_length" )
+                return {  make_value(  int( t->name.size() )  )  };
+
+            std::uint32_t  h  =  2166136261u;
+
+            for ( char const  c : t->name )
+                h = ( h ^ static_cast< unsigned char >( c ) ) * 16777619u;
+
+            return {  make_value(  static_cast< int >(  h & 0x7fffffffu  )  )  };
+        }
+
+        if ( k == "eval" )
+            return {  nullptr,  eager_eval( env, p )  };
+
+        if ( k == "eval_success" )
+            return {  make_value(  ! is_error_(  eager_eval( env, p )  )  )  };
+
+        if ( k == "import" )
+        {
+            term const  lib  =  eager_eval(  env,  p  );
+
+            if ( lib->k != kind::library )
+                return {  error_(  {  text_( "erratic import argument" ),  lib  }  )  };
+
+            return {  make(  kind::op,  {  f,  make(  kind::map,  lib->xs  )  }  )  };
+        }
+
+        if ( k == "is_atom" )
+        {
+            term const  y  =  lazy_eval(  env,  p  );
+
+            switch ( y->k )
+            {
+            case kind::value:   return {  make_value( true )  };
+            case kind::packed:  return {  make_value( false )  };
+            case kind::s:
+            case kind::lazy:    return {  make_value(  y->xs.empty()  )  };
+            case kind::call:
+                if ( y->xs.size() == 1 )
+                    return {  make_value( true )  };
+                [[fallthrough]];
+            default:            return {  error_(  {  f,  y  }  )  };
+            }
+        }
+
+        if ( k == "is_integral" )                   // Trivium Lisp has no values that are integral types
+            return {  gather_(  "Is_Integral",  {  lazy_eval( env, p )  },  [](  auto const&  ) {  return make_value( false );  }  )  };
+
+        if ( k == "requires"  &&  n == 2 )
+        {
+            term const  cond  =  eager_eval(  env,  p  );
+
+            if ( is_bool_( cond )  &&  std::get< bool >( cond->x ) )
+                return {  nullptr,  x->xs[ 2 ]  };
+
+            return {  error_(  {  f,  cond,  x->xs[ 2 ]  }  )  };
+        }
+
+        if ( k == "not" )
+        {
+            term const  b  =  eager_eval(  env,  p  );
+
+            if ( ! is_bool_( b ) )
+                return {  error_(  {  f,  b  }  )  };
+
+            return {  make_value(  ! std::get< bool >( b->x )  )  };
+        }
+
+        if ( k == "~" )
+        {
+            term const  y  =  eager_eval(  env,  p  );
+
+            if ( y->k != kind::value )
+                return {  error_(  {  f,  y  }  )  };
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wbool-operation"
+            return {  make_value(  std::visit(  [](  auto v  ) {  return number(  ~v  );  },  y->x  )  )  };
+#pragma GCC diagnostic pop
+        }
+
+        if ( k == "if" )
+        {
+            term const  cond  =  eager_eval(  env,  p  );
+
+            if ( ! is_bool_( cond ) )
+                return {  error_(  {  f,  cond  }  )  };
+
+            if ( std::get< bool >( cond->x ) )
+                return {  make( kind::K )  };
+
+            return {  make(  kind::s,  {  make( kind::K ),  make(  kind::s,  {  make( kind::S ),  make( kind::K ),  make( kind::K )  }  )  }  )  };
+        }
+
+        if ( k == "if_possible" )
+        {
+            term const  y  =  eval(  m,  env,  p  );
+
+            if ( is_error_( y ) )
+                return {  make(  kind::s,  {  make( kind::S ),  make( kind::K ),  make( kind::K )  }  )  };
+
+            return {  make(  kind::s,  {  make( kind::K ),  quoted_( y )  }  )  };
+        }
+
+        if ( k == "raise_error" )
+            return {  error_(  {  f,  eager_eval( env, p )  }  )  };
+
+        if ( k == "show_error" )
+        {
+            term const  y  =  eager_eval(  env,  p  );
+
+            return {  make(  kind::debug_output,  is_error_( y )  ?  std::vector< term >{  y  }  :  std::vector< term >{}  )  };
+        }
+
+        return {  lookup_(  env,  x  )  };
+    }
+
+
+
+//  call< 0,  op< keyword,  p... >,  q >:
+
+    inline interpreter::step interpreter::partial_(  mode  m,  lut const&  env,  term const&  x  )
+    {
+        term const&                 f   =  x->xs[ 0 ];
+        std::vector< term > const&  p   =  f->xs;
+        term const&                 q   =  x->xs[ 1 ];
+        std::string const&          k   =  p[ 0 ]->name;
+
+        if ( p[ 0 ]->k != kind::text )
+            return {  lookup_(  env,  x  )  };
+
+        if ( k == "def"  &&  p.size() == 2 )
+        {
+            term const  a  =  parser::abstraction(  {  p[ 1 ]  },  q  );
+
+            return {  op_(  {  p[ 0 ],  p[ 1 ],  eager_eval(  env,  make(  kind::s,  {  a,  make(  kind::s,  {  make( kind::Y ),  a  }  )  }  )  )  }  )  };
+        }
+
+        if ( k == "def" )
+            return {  nullptr,  q,  add_(  env,  p[ 1 ]->name,  p[ 2 ]  )  };
+
+        if ( k == "import" )
+        {
+            lut  e  =  env;
+
+            for ( term const&  d : p[ 1 ]->xs )
+                e = add_(  e,  d->xs[ 0 ]->name,  d->xs[ 1 ]  );
+
+            return {  nullptr,  q,  e  };
+        }
+
+        if ( ( k == "fold"  ||  k == "text_substr" )  &&  p.size() == 2 )
+            return {  op_(  {  p[ 0 ],  p[ 1 ],  eager_eval( env, q )  }  )  };
+
+        if ( k == "fold" )
+            return {  fold_(  m,  env,  p[ 1 ],  p[ 2 ],  eager_eval( env, q )  )  };
+
+        if ( k == "text_substr" )
+            return {  text_substr_(  p[ 1 ],  p[ 2 ],  eager_eval( env, q )  )  };
+
+        term const  y  =  eager_eval(  env,  q  );
+
+        if ( is_error_( y ) )
+            return {  gather_(  k.c_str(),  {  p[ 1 ],  y  },  [](  auto const&  ) {  return term{};  }  )  };
+
+        if ( k == "eq" )
+        {
+            term  a  =  p[ 1 ];
+            term  b  =  y;
+
+            if ( a->k == kind::packed  &&  b->k == kind::s  &&  a->ints.size() == b->xs.size() )
+                a = unpacked_( a );
+
+            if ( b->k == kind::packed  &&  a->k == kind::s  &&  b->ints.size() == a->xs.size() )
+                b = unpacked_( b );
+
+            return {  make_value(  same( a, b )  )  };
+        }
+
+        if ( k == "match" )
+            return {  match_(  p[ 1 ],  y  )  };
+
+        if ( p[ 1 ]->k != kind::text  ||  y->k != kind::text )
+            return {  error_(  {  p[ 0 ],  p[ 1 ],  y  }  )  };
+
+        if ( k == "text_concat" )
+            return {  text_(  p[ 1 ]->name + y->name  )  };
+
+        if ( k == "text_<" )
+        {
+            std::string const&  a  =  p[ 1 ]->name;
+            std::string const&  b  =  y->name;
+
+            for ( std::size_t i = 0;  i != a.size()  &&  i != b.size();  ++i )
+                if ( a[ i ] != b[ i ] )
+                    return {  make_value(  static_cast< unsigned char >( a[ i ] ) < static_cast< unsigned char >( b[ i ] )  )  };
+
+            return {  make_value(  a.size() < b.size()  )  };
+        }
+
+        return {  lookup_(  env,  x  )  };
+    }
+
+
+
+//  fold:  the left fold,  element by element
+
+    inline term interpreter::fold_(  mode  m,  lut const&  env,  term const&  f,  term  init,  term  xs  )
+    {
+        for ( ;; )
+        {
+            if ( is_error_( xs ) )
+                return gather_(  "Fold",  {  f,  init,  xs  },  [](  auto const&  ) {  return term{};  }  );
+
+            if ( xs->k == kind::packed )
+                xs = unpacked_( xs );
+
+            if ( xs->k != kind::s )
+                return error_(  {  text_( "fold" ),  f,  init,  xs  }  );
+
+            if ( xs->xs.empty() )
+                return init;
+
+            init = eval(  m,  env,  make(  kind::s,  {  f,  quoted_( init ),  quoted_(  xs->xs[ 0 ]  )  }  )  );
+            xs   = make(  kind::s,  std::vector< term >(  xs->xs.begin() + 1,  xs->xs.end()  )  );
+
+            if ( is_error_( init ) )
+                return gather_(  "Fold",  {  f,  init,  xs  },  [](  auto const&  ) {  return term{};  }  );
+        }
+    }
+
+
+
+//  text_substr:
+
+    inline term interpreter::text_substr_(  term const&  x,  term const&  begin,  term const&  end  )
+    {
+        if ( is_error_( end ) )
+            return gather_(  "Text_Substr",  {  x,  begin,  end  },  [](  auto const&  ) {  return term{};  }  );
+
+        bool  ok  =  x->k == kind::text  &&  begin->k == kind::value  &&  end->k == kind::value;
+
+        long long const  size  =  ok  ?  static_cast< long long >(  x->name.size()  )  :  0;
+
+        unsigned  b  =  0;
+        unsigned  e  =  0;
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wbool-compare"      // (unknown to clang)
+#endif
+#pragma GCC diagnostic ignored "-Wtype-limits"
+        if ( ok )
+            ok = std::visit(  [&](  auto u,  auto v  )
+                              {
+                                  b = unsigned( u );
+                                  e = unsigned( v );
+
+                                  return  0 <= u  &&  u <= v  &&  v <= size;
+                              }
+                           ,  begin->x
+                           ,  end->x
+                           );
+#pragma GCC diagnostic pop
+
+        if ( ! ok )
+            return error_(  {  text_( "text_substr" ),  x,  begin,  end  }  );
+
+        return text_(  x->name.substr(  b,  e - b  )  );
+    }
+
+
+
+//  binary operations:
+
+    struct exact_integer_
+    {
+        bool                minus;
+        unsigned long long  x;
+    };
+
+
+
+    template<  typename X  >
+    inline exact_integer_ exact_integer_of_(  X  x  )
+    {
+        if constexpr (  std::is_signed_v< X >  )
+        {
+            if ( x < 0 )
+                return {  true,  0ull - static_cast< unsigned long long >( x )  };
+        }
+
+        return {  false,  static_cast< unsigned long long >( x )  };
+    }
+
+
+
+    template<  typename R  >
+    inline bool exact_fits_(  exact_integer_  r  )
+    {
+        constexpr auto  max  =  static_cast< unsigned long long >(  std::numeric_limits< R >::max()  );
+
+        if ( r.x == 0 )
+            return true;
+
+        return  r.minus  ?  std::is_signed_v< R >  &&  r.x - 1 <= max
+                         :  r.x <= max;
+    }
+
+
+
+    //  i<>::exact_:  the mathematical result of + - * is representable
+
+    template<  typename X,  typename Y  >
+    inline bool exact_(  char  op,  X  x,  Y  y  )
+    {
+        exact_integer_        a  =  exact_integer_of_( x );
+        exact_integer_        b  =  exact_integer_of_( y );
+        exact_integer_        r  {  a.minus != b.minus,  a.x * b.x  };
+
+        if ( op == '*' )
+            return  (  a.x == 0  ||  r.x / a.x == b.x  )  &&  exact_fits_<  decltype( x * y )  >( r );
+
+        if ( op == '-' )
+            b.minus = ! b.minus;
+
+        if ( a.minus == b.minus )
+        {
+            r = {  a.minus,  a.x + b.x  };
+
+            if ( r.x < a.x )
+                return false;
+        }
+        else
+        {
+            r  =  a.x >= b.x  ?  exact_integer_{  a.minus,  a.x - b.x  }
+                              :  exact_integer_{  b.minus,  b.x - a.x  };
+        }
+
+        return exact_fits_<  decltype( x + y )  >( r );
+    }
+
+
+
+    //  The operations of C++ on the C++ types of the values, with the usual arithmetic
+    //  conversions;  operations that are no constant expressions (overflow, division by
+    //  zero, invalid shifts) have no result.
+
+    struct arithmetic_
+    {
+        std::string_view  f;
+        bool              ok  =  true;
+
+
+
+        template<  typename X,  typename Y  >
+        number operator()(  X  x,  Y  y  )
+        {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wbool-compare"      // (unknown to clang)
+#endif
+#pragma GCC diagnostic ignored "-Wbool-operation"
+#pragma GCC diagnostic ignored "-Wint-in-bool-context"
+            if ( f == "==" )  return bool( x == y );
+            if ( f == "!=" )  return bool( x != y );
+            if ( f == "<=" )  return bool( x <= y );
+            if ( f == ">=" )  return bool( x >= y );
+            if ( f == "<"  )  return bool( x <  y );
+            if ( f == ">"  )  return bool( x >  y );
+
+            if ( f == "+"  ||  f == "-"  ||  f == "*" )
+            {
+                ok = exact_(  f[ 0 ],  x,  y  );
+
+                if ( ! ok )
+                    return false;
+
+                return  f == "+"  ?  number( x + y )
+                     :  f == "-"  ?  number( x - y )
+                     :               number( x * y );
+            }
+
+            if ( f == "wrap_+"  ||  f == "wrap_-"  ||  f == "wrap_*" )
+            {
+                using R  =  decltype( x + y );
+                using U  =  std::make_unsigned_t< R >;
+
+                U const  a  =  static_cast< U >( x );
+                U const  b  =  static_cast< U >( y );
+
+                return static_cast< R >(  f[ 5 ] == '+'  ?  U( a + b )
+                                       :  f[ 5 ] == '-'  ?  U( a - b )
+                                       :                    U( a * b )
+                                       );
+            }
+
+            if ( f == "/"  ||  f == "%" )
+            {
+                using R  =  decltype( x / y );
+
+                ok = y != 0;
+
+                if constexpr (  std::is_signed_v< R >  )
+                    ok = ok  &&  !(  R( x ) == std::numeric_limits< R >::min()  &&  R( y ) == -1  );
+
+                if ( ! ok )
+                    return false;
+
+                return  f == "/"  ?  number( x / y )  :  number( x % y );
+            }
+
+            if ( f == "&" )  return number( x & y );
+            if ( f == "|" )  return number( x | y );
+            if ( f == "^" )  return number( x ^ y );
+
+            using P  =  decltype( +x );
+
+            if constexpr (  std::is_signed_v< Y >  )
+                ok = y >= 0;
+
+            ok = ok  &&  static_cast< unsigned long long >( y ) < unsigned(  std::numeric_limits<  std::make_unsigned_t< P >  >::digits  );
+
+            if ( ! ok )
+                return false;
+
+            if ( f == "<<" )
+                return number(  P(  static_cast<  std::make_unsigned_t< P >  >(  static_cast<  std::make_unsigned_t< P >  >( x )  <<  y  )  )  );
+
+            return number( x >> y );
+#pragma GCC diagnostic pop
+        }
+    };
+
+
+
+    inline term interpreter::bin_op_(  std::string const&  f,  term const&  x,  term const&  y  )
+    {
+        if ( x->k == kind::value  &&  y->k == kind::value )
+        {
+            arithmetic_   a {  f  };
+            number const  r  =  std::visit(  a,  x->x,  y->x  );
+
+            if ( a.ok )
+                return make_value( r );
+        }
+
+        if ( x->k == kind::packed  &&  y->k == kind::packed  &&  x->ints.size() == y->ints.size() )
+        {
+            std::vector< int > const&  a  =  x->ints;
+            std::vector< int > const&  b  =  y->ints;
+
+            if ( f == "==" )  return make_value( a == b );
+            if ( f == "!=" )  return make_value( a != b );
+            if ( f == "<=" )  return make_value( a <= b );
+            if ( f == ">=" )  return make_value( a >= b );
+            if ( f == "<"  )  return make_value( a <  b );
+            if ( f == ">"  )  return make_value( a >  b );
+        }
+
+        return error_(  {  text_( f ),  x,  y  }  );
+    }
+
+
+
+//  match:
+
+    inline term interpreter::match_(  term const&  p,  term const&  x  )
+    {
+        struct matcher
+        {
+            std::vector< term >  bindings;
+
+
+
+            static int hole_(  term const&  p  )            // 0: no hole,  1: ?x,  2: ?xs...
+            {
+                if ( p->k != kind::text  ||  p->name.empty()  ||  p->name[ 0 ] != '?' )
+                    return 0;
+
+                std::size_t const  n  =  p->name.size() - 1;
+
+                return  n >= 3  &&  p->name.compare(  p->name.size() - 3,  3,  "..."  ) == 0  ?  2  :  1;
+            }
+
+
+
+            void bind(  term const&  p,  term const&  x  )
+            {
+                std::string  name  =  p->name.substr( 1 );
+
+                if ( hole_( p ) == 2 )
+                    name.resize(  name.size() - 3  );
+
+                if ( ! name.empty() )
+                    bindings.push_back(  make(  kind::pair,  {  make_text( name ),  x  }  )  );
+            }
+
+
+
+            static bool misplaced_rest_(  term const&  p  )       // a rest hole before the end of a list
+            {
+                if ( p->k != kind::s )
+                    return false;
+
+                for ( std::size_t k = 0;  k != p->xs.size();  ++k )
+                    if (  ( k + 1 != p->xs.size()  &&  hole_(  p->xs[ k ]  ) == 2 )  ||  misplaced_rest_(  p->xs[ k ]  )  )
+                        return true;
+
+                return false;
+            }
+
+
+
+            bool operator()(  term const&  p,  term const&  x  )
+            {
+                if ( hole_( p ) != 0 )
+                {
+                    bind(  p,  x  );
+                    return true;
+                }
+
+                if ( p->k != kind::s  ||  x->k != kind::s )
+                    return same(  p,  x  );
+
+                std::size_t const  n     =  p->xs.size();
+                bool const         rest  =  n != 0  &&  hole_(  p->xs.back()  ) == 2;
+
+                if ( rest  ?  n > x->xs.size() + 1  :  n != x->xs.size() )
+                    return false;
+
+                bool  ok  =  true;
+
+                for ( std::size_t k = 0;  k != n - rest;  ++k )
+                    ok = (*this)(  p->xs[ k ],  x->xs[ k ]  )  &&  ok;
+
+                if ( rest )
+                    bind(  p->xs.back(),  make(  kind::s,  std::vector< term >(  x->xs.begin() + ( n - 1 ),  x->xs.end()  )  )  );
+
+                return ok;
+            }
+        };
+
+        if ( matcher::misplaced_rest_( p ) )
+            return error_(  {  text_( "rest hole before the end of a match pattern: " ),  p  }  );
+
+        matcher  match;
+
+        if ( ! match(  p,  x  ) )
+            return error_(  {  text_( "match" ),  p,  x  }  );
+
+        for ( std::size_t i = 0;  i != match.bindings.size();  ++i )
+            for ( std::size_t j = 0;  j != i;  ++j )
+                if ( match.bindings[ i ]->xs[ 0 ]->name == match.bindings[ j ]->xs[ 0 ]->name )
+                    return error_(  {  text_( "repeated hole in match pattern: " ),  p  }  );
+
+        return make(  kind::library,  std::move( match.bindings )  );
+    }
+
+
+
+// -----------------------------------------------------------------------------
+//  The public interface:
+// -----------------------------------------------------------------------------
+
+
+    //  lt::eval< src >
+
+    inline term evaluate(  term const&  x  )
+    {
+        return interpreter{}.eager_eval(  nullptr,  x  );
+    }
+
+
+
+    inline term evaluate(  std::string_view  src  )
+    {
+        return evaluate(  program( src )  );
+    }
+
+
+
+    inline bool uses_eval_hpp(  term const&  x  )       // op, Y, i and debug_output are declared in eval.hpp
+    {
+        if ( x->k == kind::op  ||  x->k == kind::Y  ||  x->k == kind::library  ||  x->k == kind::debug_output )
+            return true;
+
+        for ( term const&  y : x->xs )
+            if ( uses_eval_hpp( y ) )
+                return true;
+
+        return false;
+    }
+
+
+
+    //  The C++ type of a term.  Terms that contain private types of the interpreter
+    //  (calls and errors) can not be named outside of lt::i<>:  cpp_type throws unless
+    //  diagnostic is set,  which spells them as lt::i<>::call< ... > etc.
+
+    inline std::string cpp_type(  term const&  x,  bool  diagnostic = false  )
+    {
+        auto const  list  =  [&](  std::string  name,  std::vector< term > const&  xs  )
+        {
+            if ( xs.empty() )
+                return name + "<>";
+
+            name += "< ";
+
+            for ( std::size_t k = 0;  k != xs.size();  ++k )
+                name += (  k == 0  ?  ""  :  ", "  ) + cpp_type(  xs[ k ],  diagnostic  );
+
+            return name + " >";
+        };
+
+        auto const  integer  =  [](  auto n  )  ->  std::string
+        {
+            using N  =  decltype( n );
+
+            if constexpr (  std::is_same_v< N, bool >  )
+                return  n  ?  "true"  :  "false";
+            else if constexpr (  std::is_same_v< N, int >  )
+                return  n == std::numeric_limits< int >::min()  ?  "( -2147483647 - 1 )"  :  std::to_string( n );
+            else if constexpr (  std::is_same_v< N, unsigned >  )
+                return  std::to_string( n ) + "u";
+            else if constexpr (  std::is_same_v< N, long long >  )
+                return  n == std::numeric_limits< long long >::min()  ?  "( -9223372036854775807ll - 1 )"  :  std::to_string( n ) + "ll";
+            else
+                return  std::to_string( n ) + "ull";
+        };
+
+        if ( ! diagnostic  &&  (  x->k == kind::call  ||  x->k == kind::lazy  ||  x->k == kind::error  ||  x->k == kind::class_template  )  )
+            throw error(  "the result contains a private type of lt::i<>:  " + cpp_type(  x,  true  )  );
+
+        switch ( x->k )
+        {
+        case kind::S:               return "lt::S";
+        case kind::K:               return "lt::K";
+        case kind::Y:               return "lt::Y";
+        case kind::s:               return list(  "lt::s",  x->xs  );
+        case kind::quoted:          return list(  "lt::quoted",  x->xs  );
+        case kind::op:              return list(  "lt::op",  x->xs  );
+        case kind::pair:            return list(  "lt::pair",  x->xs  );
+        case kind::library:         return list(  "lt::i",  x->xs  );
+        case kind::map:             return list(  "lt::map",  x->xs  );
+        case kind::debug_output:    return list(  "lt::debug_output",  x->xs  );
+        case kind::lazy:            return list(  "lt::i<>::lazy",  x->xs  );
+        case kind::error:           return list(  "lt::i<>::eval_error",  x->xs  );
+        case kind::class_template:  return "lt::ct< " + x->name + " >";
+        case kind::list:            return "lt::list< " + std::to_string( x->n ) + " >";
+
+        case kind::call:
+        {
+            std::string const  s  =  list(  "",  x->xs  );
+
+            return "lt::i<>::call< " + std::to_string( x->n ) + (  x->xs.empty()  ?  ""  :  ", " + s.substr( 2,  s.size() - 4 )  ) + " >";
+        }
+
+        case kind::value:
+            return "lt::value< " + std::visit(  integer,  x->x  ) + " >";
+
+        case kind::packed:
+        {
+            std::string  s  =  "lt::packed< ";
+
+            for ( std::size_t k = 0;  k != x->ints.size();  ++k )
+                s += (  k == 0  ?  ""  :  ", "  ) + integer(  x->ints[ k ]  );
+
+            return s + " >";
+        }
+
+        case kind::text:
+        {
+            if ( x->name.empty() )
+                return "lt::text<>";
+
+            std::string  s  =  "lt::text< ";
+
+            for ( std::size_t k = 0;  k != x->name.size();  ++k )
+            {
+                char const  c  =  x->name[ k ];
+                char        hex[ 8 ];
+
+                s += k == 0  ?  "'"  :  ", '";
+
+                if ( c == '\''  ||  c == '\\' )
+                    s += std::string( "\\" ) + c;
+                else if ( ' ' <= c  &&  c <= '~' )
+                    s += c;
+                else
+                    s += (  hex[ 0 ] = '\\',  hex[ 1 ] = 'x',  hex[ 2 ] = "0123456789abcdef"[ static_cast< unsigned char >( c ) >> 4 ]
+                         ,  hex[ 3 ] = "0123456789abcdef"[ c & 15 ],  hex[ 4 ] = '\0',  hex  );
+
+                s += "'";
+            }
+
+            return s + " >";
+        }
+        }
+
+        return {};
+    }
+}
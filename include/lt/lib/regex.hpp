@@ -0,0 +1,923 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "../text.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+
+namespace lt::lib
+{
+//  Regular expressions compiled to DFA tables:
+//
+//  regex< "pattern" > compiles the pattern at compile time:  Thompson construction of an
+//  NFA, subset construction of a DFA over the byte classes of the pattern (bytes that
+//  no part of the pattern distinguishes share a column) and minimization of the DFA
+//  (Moore;  byte classes with equal columns are merged as well).  What remains at runtime is a constexpr transition table;  the matcher
+//  performs two table reads per byte and no branches besides the loop.
+//
+//  match( s )   is true if the whole of s matches the pattern.
+//  search( s )  is true if a substring of s matches the pattern.  (The search DFA runs
+//               ".*pattern" with absorbing accepting states.)
+//
+//  Syntax:  literals,  .  (any byte but '\n'),  [...],  [^...],  ranges a-z,  escapes
+//  \d \D \w \W \s \S \n \r \t \f \v \0  and  \c  for a literal c,  grouping ( ),
+//  alternation |,  and the quantifiers  *  +  ?  {m}  {m,}  {m,n}.  There are no anchors
+//  ( match is anchored, search is not ), captures or backreferences.  Errors in the
+//  pattern are compile-time errors.
+
+    struct regex_
+    {
+    private:
+
+        template<  t<>::literal  >
+        friend struct regex;
+
+
+
+        static void error_(  char const*  )  {  }        // not constexpr:  a call is a compile-time error
+
+
+
+        struct char_set_
+        {
+            std::uint64_t  bits[ 4 ]  =  {};
+
+
+            constexpr void add(  unsigned char  c  )  noexcept
+            {
+                bits[ c / 64 ]  |=  std::uint64_t( 1 ) << ( c % 64 );
+            }
+
+
+            constexpr void add(  unsigned char  lo,  unsigned char  hi  )  noexcept
+            {
+                for ( unsigned c = lo;  c <= hi;  ++c )
+                    add(  static_cast< unsigned char >( c )  );
+            }
+
+
+            constexpr void add(  char_set_ const&  other  )  noexcept
+            {
+                for ( unsigned k = 0;  k != 4;  ++k )
+                    bits[ k ]  |=  other.bits[ k ];
+            }
+
+
+            constexpr void invert()  noexcept
+            {
+                for ( auto& b : bits )
+                    b = ~b;
+            }
+
+
+            constexpr bool contains(  unsigned char  c  )  const noexcept
+            {
+                return  ( bits[ c / 64 ] >> ( c % 64 ) )  &  1;
+            }
+
+
+            constexpr bool empty()  const noexcept
+            {
+                return  ( bits[ 0 ] | bits[ 1 ] | bits[ 2 ] | bits[ 3 ] )  ==  0;
+            }
+        };
+
+
+
+        // ---------------------------------------------------------------------------------------
+        //
+        //  Thompson construction:  every fragment has a begin and an end node;  end nodes have
+        //  no outgoing edges until the fragment is combined.  A node has either one character
+        //  edge or at most two epsilon edges.
+        //
+        // ---------------------------------------------------------------------------------------
+
+        struct node_
+        {
+            char_set_    set;                   //  empty:  no character edge
+            std::size_t  next     =  0;
+            std::size_t  eps[ 2 ] =  {};
+            std::size_t  n_eps    =  0;
+        };
+
+
+
+        struct fragment_
+        {
+            std::size_t  begin;
+            std::size_t  end;
+        };
+
+
+
+        struct nfa_
+        {
+            std::vector< node_ >  nodes;
+            std::string_view      pattern;
+            std::size_t           pos  =  0;
+
+
+
+            constexpr std::size_t node()
+            {
+                nodes.push_back(  node_{}  );
+                return nodes.size() - 1;
+            }
+
+
+            constexpr void eps(  std::size_t  from,  std::size_t  to  )
+            {
+                nodes[ from ].eps[ nodes[ from ].n_eps++ ]  =  to;
+            }
+
+
+
+            constexpr fragment_ empty()
+            {
+                std::size_t const n = node();
+                return {  n,  n  };
+            }
+
+
+            constexpr fragment_ atom(  char_set_ const&  set  )
+            {
+                std::size_t const b = node();
+                std::size_t const e = node();
+
+                nodes[ b ].set   =  set;
+                nodes[ b ].next  =  e;
+
+                return {  b,  e  };
+            }
+
+
+            constexpr fragment_ concat(  fragment_  x,  fragment_  y  )
+            {
+                eps(  x.end,  y.begin  );
+                return {  x.begin,  y.end  };
+            }
+
+
+            constexpr fragment_ alternative(  fragment_  x,  fragment_  y  )
+            {
+                std::size_t const b = node();
+                std::size_t const e = node();
+
+                eps( b,  x.begin );   eps( b,  y.begin );
+                eps( x.end,  e );     eps( y.end,  e );
+
+                return {  b,  e  };
+            }
+
+
+            constexpr fragment_ star(  fragment_  x  )
+            {
+                std::size_t const b = node();
+                std::size_t const e = node();
+
+                eps( b,  x.begin );       eps( b,  e );
+                eps( x.end,  x.begin );   eps( x.end,  e );
+
+                return {  b,  e  };
+            }
+
+
+            constexpr fragment_ plus(  fragment_  x  )
+            {
+                std::size_t const e = node();
+
+                eps( x.end,  x.begin );   eps( x.end,  e );
+
+                return {  x.begin,  e  };
+            }
+
+
+            constexpr fragment_ optional(  fragment_  x  )
+            {
+                std::size_t const b = node();
+
+                eps( b,  x.begin );   eps( b,  x.end );
+
+                return {  b,  x.end  };
+            }
+
+
+
+            //  Parser (recursive descent):
+            //
+            //      alternation  :=  sequence ( '|' sequence )*
+            //      sequence     :=  piece*
+            //      piece        :=  atom ( '*' | '+' | '?' | '{' m [ ',' [ n ] ] '}' )*
+            //      atom         :=  '(' alternation ')'  |  '[' class ']'  |  '.'  |  '\' c  |  c
+
+            constexpr bool at_end()  const noexcept  {  return pos == pattern.size();  }
+
+            constexpr char peek()  const noexcept  {  return pattern[ pos ];  }
+
+
+            constexpr char take()
+            {
+                if ( at_end() )
+                    error_( "regex:  unexpected end of pattern" );
+
+                return pattern[ pos++ ];
+            }
+
+
+
+            constexpr fragment_ alternation()
+            {
+                fragment_ f = sequence();
+
+                while ( ! at_end()  &&  peek() == '|' )
+                {
+                    ++pos;
+                    f = alternative(  f,  sequence()  );
+                }
+
+                return f;
+            }
+
+
+
+            constexpr fragment_ sequence()
+            {
+                fragment_ f = empty();
+
+                while ( ! at_end()  &&  peek() != '|'  &&  peek() != ')' )
+                    f = concat(  f,  piece( pattern.size() )  );
+
+                return f;
+            }
+
+
+
+            //  Counted repetitions parse the piece once more for every further copy;  limit
+            //  is the position of the quantifier that is being expanded.
+
+            constexpr fragment_ piece(  std::size_t  limit  )
+            {
+                std::size_t const begin = pos;
+
+                fragment_ f = atom();
+
+                while ( pos < limit  &&  ! at_end() )
+                {
+                    char const q = peek();
+
+                    if ( q == '*' )       {  ++pos;  f = star( f );  }
+                    else if ( q == '+' )  {  ++pos;  f = plus( f );  }
+                    else if ( q == '?' )  {  ++pos;  f = optional( f );  }
+                    else if ( q == '{' )  {  f = counted(  f,  begin  );  }
+                    else
+                        break;
+                }
+
+                return f;
+            }
+
+
+
+            constexpr std::size_t number()
+            {
+                if ( at_end()  ||  peek() < '0'  ||  peek() > '9' )
+                    error_( "regex:  number expected in {m,n}" );
+
+                std::size_t n = 0;
+
+                while ( ! at_end()  &&  '0' <= peek()  &&  peek() <= '9' )
+                    n  =  10 * n  +  ( take() - '0' );
+
+                return n;
+            }
+
+
+
+            constexpr fragment_ counted(  fragment_  f,  std::size_t  begin  )
+            {
+                std::size_t const brace = pos++;
+
+                std::size_t const  m          =  number();
+                std::size_t        n          =  m;
+                bool               unbounded  =  false;
+
+                if ( ! at_end()  &&  peek() == ',' )
+                {
+                    ++pos;
+
+                    if ( ! at_end()  &&  peek() == '}' )
+                        unbounded = true;
+                    else
+                        n = number();
+                }
+
+                if ( take() != '}' )
+                    error_( "regex:  '}' expected" );
+
+                if ( n < m  ||  n > 1000 )
+                    error_( "regex:  invalid counts in {m,n}" );
+
+
+                std::size_t const after = pos;
+
+                bool       used  =  m != 0;
+                fragment_  r     =  used  ?  f  :  empty();
+
+                for ( std::size_t k = 1;  k < m;  ++k )
+                    r = concat(  r,  copy(  begin,  brace  )  );
+
+                if ( unbounded )
+                    r = concat(  r,  star(  used  ?  copy(  begin,  brace  )  :  f  )  );
+                else
+                    for ( std::size_t k = m;  k != n;  ++k,  used = true )
+                        r = concat(  r,  optional(  used  ?  copy(  begin,  brace  )  :  f  )  );
+
+                pos = after;
+
+                return r;
+            }
+
+
+
+            constexpr fragment_ copy(  std::size_t  begin,  std::size_t  limit  )
+            {
+                pos = begin;
+                return piece( limit );
+            }
+
+
+
+            constexpr fragment_ atom()
+            {
+                char const c = take();
+
+                switch ( c )
+                {
+                    case '(':
+                    {
+                        fragment_ const f = alternation();
+
+                        if ( take() != ')' )
+                            error_( "regex:  ')' expected" );
+
+                        return f;
+                    }
+
+                    case '[':   return atom(  bracket()  );
+                    case '\\':  return atom(  escape()  );
+
+                    case '.':
+                    {
+                        char_set_ s;
+                        s.add( '\n' );
+                        s.invert();
+
+                        return atom( s );
+                    }
+
+                    case ')':  case '*':  case '+':  case '?':  case '{':  case '}':  case ']':
+                        error_( "regex:  unexpected special character" );
+                        return empty();
+
+                    case '^':  case '$':
+                        error_( "regex:  anchors are not supported (match is anchored, search is not)" );
+                        return empty();
+
+                    default:
+                    {
+                        char_set_ s;
+                        s.add(  static_cast< unsigned char >( c )  );
+
+                        return atom( s );
+                    }
+                }
+            }
+
+
+
+            constexpr char_set_ escape()
+            {
+                char const c = take();
+
+                char_set_  s;
+
+                switch ( c )
+                {
+                    case 'd':  case 'D':  s.add( '0', '9' );                                              break;
+                    case 'w':  case 'W':  s.add( 'a', 'z' );  s.add( 'A', 'Z' );  s.add( '0', '9' );  s.add( '_' );  break;
+                    case 's':  case 'S':  s.add( ' ' );  s.add( '\t', '\r' );                             break;     // \t \n \v \f \r
+                    case 'n':  s.add( '\n' );  break;
+                    case 'r':  s.add( '\r' );  break;
+                    case 't':  s.add( '\t' );  break;
+                    case 'f':  s.add( '\f' );  break;
+                    case 'v':  s.add( '\v' );  break;
+                    case '0':  s.add( '\0' );  break;
+
+                    default:   s.add(  static_cast< unsigned char >( c )  );
+                }
+
+                if ( c == 'D'  ||  c == 'W'  ||  c == 'S' )
+                    s.invert();
+
+                return s;
+            }
+
+
+
+            constexpr char_set_ bracket()
+            {
+                char_set_  s;
+
+                bool const negated  =  ! at_end()  &&  peek() == '^';
+
+                if ( negated )
+                    ++pos;
+
+                for ( bool first = true;  first  ||  peek() != ']';  first = false )
+                {
+                    char const c = take();
+
+                    if ( c == '\\' )
+                    {
+                        s.add(  escape()  );
+                    }
+                    else if ( pos + 1 < pattern.size()  &&  peek() == '-'  &&  pattern[ pos + 1 ] != ']' )
+                    {
+                        ++pos;
+
+                        char const d = take();
+
+                        if ( static_cast< unsigned char >( d ) < static_cast< unsigned char >( c ) )
+                            error_( "regex:  invalid range in [...]" );
+
+                        s.add(  static_cast< unsigned char >( c ),  static_cast< unsigned char >( d )  );
+                    }
+                    else
+                    {
+                        s.add(  static_cast< unsigned char >( c )  );
+                    }
+
+                    if ( at_end() )
+                        error_( "regex:  ']' expected" );
+                }
+
+                ++pos;
+
+                if ( negated )
+                    s.invert();
+
+                return s;
+            }
+        };
+
+
+
+        // ---------------------------------------------------------------------------------------
+        //
+        //  Subset construction and minimization:  DFA state 0 is the dead state.
+        //
+        // ---------------------------------------------------------------------------------------
+
+        struct dfa_
+        {
+            unsigned char               class_of[ 256 ]  =  {};
+            std::size_t                 classes          =  1;
+            std::vector< std::size_t >  next;                         //  next[ state * classes + class ]
+            std::vector< bool >         accept;
+            std::size_t                 start            =  0;
+
+
+            constexpr std::size_t states()  const noexcept  {  return accept.size();  }
+        };
+
+
+
+        static constexpr void classes_(  nfa_ const&  nfa,  dfa_&  dfa  )
+        {
+            for ( node_ const& n : nfa.nodes )
+            {
+                if ( n.set.empty() )
+                    continue;
+
+                int            remap[ 512 ]  =  {};
+                std::size_t    count         =  0;
+
+                for ( auto& r : remap )
+                    r = -1;
+
+                for ( unsigned c = 0;  c != 256;  ++c )
+                {
+                    int& r  =  remap[  2 * dfa.class_of[ c ]  +  n.set.contains(  static_cast< unsigned char >( c )  )  ];
+
+                    if ( r < 0 )
+                        r = static_cast< int >( count++ );
+
+                    dfa.class_of[ c ] = static_cast< unsigned char >( r );
+                }
+
+                dfa.classes = count;
+            }
+        }
+
+
+
+        //  NFA state sets are bit sets of W words, stored back to back in one vector.  The
+        //  successor set of a DFA state under class k is the union of the epsilon closures
+        //  of the targets of the character edges that accept k.
+
+        static constexpr std::vector< std::uint64_t > closures_(  nfa_ const&  nfa,  std::size_t  W  )
+        {
+            std::size_t const N = nfa.nodes.size();
+
+            std::vector< std::uint64_t >  closure(  N * W,  0  );
+            std::vector< std::size_t >    stack;
+
+            for ( std::size_t i = 0;  i != N;  ++i )
+            {
+                std::uint64_t* const  c  =  closure.data() + i * W;
+
+                c[ i / 64 ]  |=  std::uint64_t( 1 ) << ( i % 64 );
+                stack.push_back( i );
+
+                while ( ! stack.empty() )
+                {
+                    node_ const& n = nfa.nodes[ stack.back() ];
+                    stack.pop_back();
+
+                    for ( std::size_t e = 0;  e != n.n_eps;  ++e )
+                    {
+                        std::size_t const j = n.eps[ e ];
+
+                        if ( ! ( c[ j / 64 ] >> ( j % 64 ) & 1 ) )
+                        {
+                            c[ j / 64 ]  |=  std::uint64_t( 1 ) << ( j % 64 );
+                            stack.push_back( j );
+                        }
+                    }
+                }
+            }
+
+            return closure;
+        }
+
+
+
+        static constexpr dfa_ subsets_(  nfa_ const&  nfa,  std::size_t  start,  std::size_t  accept,  bool  absorbing  )
+        {
+            dfa_  dfa;
+
+            classes_(  nfa,  dfa  );
+
+            std::size_t const  N  =  nfa.nodes.size();
+            std::size_t const  W  =  ( N + 63 ) / 64;
+            std::size_t const  C  =  dfa.classes;
+
+            std::vector< std::uint64_t > const  closure  =  closures_(  nfa,  W  );
+
+
+            std::vector< std::size_t >  edges;                      //  nodes with a character edge
+            std::vector< bool >         accepts;                    //  accepts[ e * C + k ]:  edge e accepts class k
+
+            for ( std::size_t i = 0;  i != N;  ++i )
+                if ( ! nfa.nodes[ i ].set.empty() )
+                    edges.push_back( i );
+
+            accepts.resize(  edges.size() * C  );
+
+            for ( std::size_t e = 0;  e != edges.size();  ++e )
+                for ( unsigned c = 0;  c != 256;  ++c )
+                    if ( nfa.nodes[ edges[ e ] ].set.contains(  static_cast< unsigned char >( c )  ) )
+                        accepts[ e * C + dfa.class_of[ c ] ] = true;
+
+
+            std::vector< std::uint64_t >  sets(  2 * W,  0  );      //  dead state, start state
+
+            for ( std::size_t w = 0;  w != W;  ++w )
+                sets[ W + w ] = closure[ start * W + w ];
+
+            dfa.start = 1;
+
+
+            std::vector< std::uint64_t >  targets(  C * W  );
+
+            for ( std::size_t s = 0;  s * W != sets.size();  ++s )
+            {
+                bool const accepting  =  sets[ s * W + accept / 64 ] >> ( accept % 64 ) & 1;
+
+                dfa.accept.push_back( accepting );
+
+                if ( accepting  &&  absorbing )
+                {
+                    for ( std::size_t k = 0;  k != C;  ++k )
+                        dfa.next.push_back( s );
+
+                    continue;
+                }
+
+
+                for ( auto& t : targets )
+                    t = 0;
+
+                for ( std::size_t e = 0;  e != edges.size();  ++e )
+                {
+                    std::size_t const i = edges[ e ];
+
+                    if ( ! ( sets[ s * W + i / 64 ] >> ( i % 64 ) & 1 ) )
+                        continue;
+
+                    std::size_t const next = nfa.nodes[ i ].next;
+
+                    for ( std::size_t k = 0;  k != C;  ++k )
+                        if ( accepts[ e * C + k ] )
+                            for ( std::size_t w = 0;  w != W;  ++w )
+                                targets[ k * W + w ]  |=  closure[ next * W + w ];
+                }
+
+
+                for ( std::size_t k = 0;  k != C;  ++k )
+                {
+                    std::size_t t = 0;
+
+                    for ( ;  t * W != sets.size();  ++t )
+                    {
+                        std::size_t w = 0;
+
+                        while ( w != W  &&  sets[ t * W + w ] == targets[ k * W + w ] )
+                            ++w;
+
+                        if ( w == W )
+                            break;
+                    }
+
+                    if ( t * W == sets.size() )
+                        for ( std::size_t w = 0;  w != W;  ++w )
+                            sets.push_back(  targets[ k * W + w ]  );
+
+                    dfa.next.push_back( t );
+                }
+            }
+
+            return dfa;
+        }
+
+
+
+        //  Moore's algorithm:  states are split by acceptance and then by the blocks of their
+        //  successors until the partition is stable.  The dead state stays state 0.
+
+        static constexpr dfa_ minimize_(  dfa_ const&  dfa  )
+        {
+            std::size_t const  N  =  dfa.states();
+            std::size_t const  C  =  dfa.classes;
+
+            std::vector< std::size_t >  block( N );
+
+            for ( std::size_t s = 0;  s != N;  ++s )
+                block[ s ]  =  dfa.accept[ s ] != dfa.accept[ 0 ];
+
+            std::size_t blocks = 0;
+
+            for ( ;; )
+            {
+                std::vector< std::size_t >     next_block( N );
+                std::vector< std::size_t >     first;          //  first state of every new block
+                std::vector< std::uint64_t >   hash;           //  signature hash of every new block
+
+                for ( std::size_t s = 0;  s != N;  ++s )
+                {
+                    std::uint64_t h = block[ s ];
+
+                    for ( std::size_t k = 0;  k != C;  ++k )
+                        h  =  ( h ^ block[ dfa.next[ s * C + k ] ] ) * 0x100000001b3ull;
+
+                    std::size_t b = 0;
+
+                    for ( ;  b != first.size();  ++b )
+                    {
+                        if ( hash[ b ] != h )
+                            continue;
+
+                        std::size_t const r = first[ b ];
+
+                        bool same  =  block[ r ] == block[ s ];
+
+                        for ( std::size_t k = 0;  same  &&  k != C;  ++k )
+                            same  =  block[ dfa.next[ r * C + k ] ]  ==  block[ dfa.next[ s * C + k ] ];
+
+                        if ( same )
+                            break;
+                    }
+
+                    if ( b == first.size() )
+                    {
+                        first.push_back( s );
+                        hash.push_back( h );
+                    }
+
+                    next_block[ s ] = b;
+                }
+
+                block = next_block;
+
+                if ( first.size() == blocks )
+                    break;
+
+                blocks = first.size();
+            }
+
+
+            //  Classes with equal columns in the minimal DFA are merged.
+
+            std::vector< std::size_t >  column( C );
+            std::size_t                 columns = 0;
+
+            for ( std::size_t k = 0;  k != C;  ++k )
+            {
+                std::size_t j = 0;
+
+                for ( ;  j != k;  ++j )
+                {
+                    bool same = true;
+
+                    for ( std::size_t s = 0;  same  &&  s != N;  ++s )
+                        same  =  block[ dfa.next[ s * C + j ] ]  ==  block[ dfa.next[ s * C + k ] ];
+
+                    if ( same )
+                        break;
+                }
+
+                column[ k ]  =  j == k  ?  columns++  :  column[ j ];
+            }
+
+
+            dfa_  m;
+
+            for ( unsigned c = 0;  c != 256;  ++c )
+                m.class_of[ c ] = static_cast< unsigned char >(  column[ dfa.class_of[ c ] ]  );
+
+            m.classes  =  columns;
+            m.start    =  block[ dfa.start ];
+            m.accept.resize( blocks );
+            m.next.resize( blocks * columns );
+
+            for ( std::size_t s = 0;  s != N;  ++s )
+            {
+                m.accept[ block[ s ] ]  =  dfa.accept[ s ];
+
+                for ( std::size_t k = 0;  k != C;  ++k )
+                    m.next[ block[ s ] * columns + column[ k ] ]  =  block[ dfa.next[ s * C + k ] ];
+            }
+
+            return m;
+        }
+
+
+
+        static constexpr dfa_ compile_(  std::string_view  pattern,  bool  search  )
+        {
+            nfa_  nfa;
+            nfa.pattern = pattern;
+
+            fragment_ f = nfa.alternation();
+
+            if ( ! nfa.at_end() )
+                error_( "regex:  unbalanced ')'" );
+
+            if ( search )        //  .* in front:  s --eps--> ( any --> s ),  s --eps--> f
+            {
+                std::size_t const s    =  nfa.node();
+                std::size_t const any  =  nfa.node();
+
+                nfa.nodes[ any ].set.invert();
+                nfa.nodes[ any ].next = s;
+
+                nfa.eps( s,  any );
+                nfa.eps( s,  f.begin );
+
+                f.begin = s;
+            }
+
+            return minimize_(  subsets_(  nfa,  f.begin,  f.end,  search  )  );
+        }
+
+
+
+        struct shape_
+        {
+            std::size_t  states;
+            std::size_t  classes;
+        };
+
+
+        static constexpr shape_ shape_of_(  std::string_view  pattern,  bool  search  )
+        {
+            dfa_ const dfa = compile_(  pattern,  search  );
+
+            return {  dfa.states(),  dfa.classes  };
+        }
+
+
+
+        //  The runtime table:  entries of next are premultiplied by the number of classes.
+
+        template<  shape_ shape  >
+        struct table_
+        {
+            using state  =  std::conditional_t<  shape.states * shape.classes <= 0x100,     std::uint8_t
+                         ,  std::conditional_t<  shape.states * shape.classes <= 0x10000,   std::uint16_t
+                         ,                                                                  std::uint32_t
+                         >>;
+
+
+            unsigned char  class_of[ 256 ]                        =  {};
+            state          next[ shape.states * shape.classes ]   =  {};
+            bool           accept[ shape.states ]                 =  {};
+            state          start                                  =  0;
+
+
+
+            constexpr bool run(  std::string_view  s  )  const noexcept
+            {
+                std::size_t q = start;
+
+                for ( char c : s )
+                    q = next[  q  +  class_of[ static_cast< unsigned char >( c ) ]  ];
+
+                return accept[ q / shape.classes ];
+            }
+        };
+
+
+
+        template<  shape_ shape  >
+        static constexpr table_< shape > table_of_(  std::string_view  pattern,  bool  search  )
+        {
+            using state  =  typename table_< shape >::state;
+
+            dfa_ const dfa = compile_(  pattern,  search  );
+
+            table_< shape >  t;
+
+            for ( unsigned c = 0;  c != 256;  ++c )
+                t.class_of[ c ] = dfa.class_of[ c ];
+
+            for ( std::size_t k = 0;  k != shape.states * shape.classes;  ++k )
+                t.next[ k ] = static_cast< state >(  dfa.next[ k ] * shape.classes  );
+
+            for ( std::size_t s = 0;  s != shape.states;  ++s )
+                t.accept[ s ] = dfa.accept[ s ];
+
+            t.start = static_cast< state >(  dfa.start * shape.classes  );
+
+            return t;
+        }
+    };
+
+
+
+    template<  t<>::literal Pattern  >
+    struct regex
+    {
+    private:
+
+        static constexpr std::string_view  pattern_{  Pattern.content,  sizeof( Pattern.content ) - 1  };
+
+        static constexpr regex_::shape_  match_shape_   =  regex_::shape_of_(  pattern_,  false  );
+        static constexpr regex_::shape_  search_shape_  =  regex_::shape_of_(  pattern_,  true  );
+
+        static constexpr auto  match_table_   =  regex_::table_of_< match_shape_ >(  pattern_,  false  );
+        static constexpr auto  search_table_  =  regex_::table_of_< search_shape_ >(  pattern_,  true  );
+
+
+    public:
+
+        static constexpr std::size_t  states  =  match_shape_.states;       //  of the minimal DFA (with the dead state)
+        static constexpr std::size_t  classes =  match_shape_.classes;      //  byte classes
+
+
+
+        static constexpr bool match(  std::string_view  s  )  noexcept
+        {
+            return match_table_.run( s );
+        }
+
+
+        static constexpr bool search(  std::string_view  s  )  noexcept
+        {
+            return search_table_.run( s );
+        }
+    };
+}
@@ -17,7 +17,7 @@ namespace lt::lib
 {
     using ts =
     lt::metaprogram<
-R"( [ @lisp_to_cpp  @cpp_to_lisp  @sizeof  @alignof ]
+R"( [ @lisp_to_cpp  @cpp_to_lisp  @sizeof  @alignof  @flatten_template  @unique_types  @sort_types_by ]
     {
         ( def 'lisp_to_cpp   @lisp_to_cpp )
 
@@ -27,33 +27,31 @@ R"( [ @lisp_to_cpp  @cpp_to_lisp  @sizeof  @alignof ]
 
         ( def 'alignof       @alignof     )
 
-        (   def 'type_matches_pattern [ pattern  type ]
+        ( def 'flatten_template  @flatten_template )
 
-             (  if   ( or  ( eq pattern () )  ( eq type () )  )
+        ( def 'unique_types      @unique_types     )
 
-                     (  eq pattern () )
+        ( def 'sort_types_by     @sort_types_by    )    ; ( sort_types_by key type ), descending by key
 
-                     (  if  ( eq  (first pattern)  (first type ) )
-                            ( type_matches_pattern  (drop_first pattern)  (drop_first  type)  )
-                            false
-                    )
-            )
+        (   def 'type_matches_pattern [ pattern  type ]    ; pattern is a prefix of type
+
+            (  eval_success  ( match  ( rcons '?...  pattern )  type )  )
         )
 
         (   def 'apply_type_pattern [ pattern type ]
 
-            (   if  ( eq patern () )
+            (   if  ( eq pattern () )
 
                     type
 
-                    (  apply_pattern  ( drop_first pattern )  ( cons  (first pattern) type  )  )
+                    (  cons  ( first pattern )  ( apply_type_pattern  ( drop_first pattern )  type  )  )
             )
         )
 
 
         (   def 'drop_type_pattern[ pattern type ]
 
-            (   if ( matches_pattern pattern type  )
+            (   if ( type_matches_pattern pattern type  )
 
                 (   def 'drop_ [n t]
                     (   if  (eq n 0)
@@ -74,5 +72,8 @@ R"( [ @lisp_to_cpp  @cpp_to_lisp  @sizeof  @alignof ]
     ,  combinator<  1,  ts_rep::template cpp_to_lisp  >
     ,  combinator<  1,  ts_rep::template sizeof_      >
     ,  combinator<  1,  ts_rep::template alignof_     >
+    ,  combinator<  1,  ts_rep::template flatten_template  >
+    ,  combinator<  1,  ts_rep::template unique_types      >
+    ,  combinator<  2,  ts_rep::template sort_types_by     >
     >;
 }
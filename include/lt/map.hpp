@@ -15,12 +15,144 @@
 
 namespace lt
 {
+    // key_table< Xs... > is a lookup table from the keys  typename Xs::key  to the
+    // positions and types of Xs...:  Its table derives from one slot< i, key, X > per X,
+    // such that
+    //
+    //     key_table< Xs... >::index_of( type_hull< Key >{} )    and
+    //     key_table< Xs... >::template type< Key >
+    //
+    // are found with a single template argument deduction against these bases, i.e.
+    // without recursive instantiations and without overload resolution over all keys.
+    // Both are substitution failures if Key is missing or not unique.
+    //
+    template<  typename... Xs  >
+    struct key_table;
+
+
+
+    //  the implementation of key_table:
+
+    struct key_table_
+    {
+        template<  unsigned... >
+        struct index_sequence {};
+
+
+#ifdef _MSC_VER
+#pragma warning( push )
+#pragma warning( disable: 4067 )
+#endif
+
+//  disable "warning C4067: unexpected tokens following preprocessor directive - expected a newline"
+//  in the #if macro below:
+
+#if defined(_MSC_VER) || __has_builtin(__make_integer_seq)
+
+#ifdef _MSC_VER
+#pragma warning( pop )
+#endif
+
+        template<  typename T,  T...  t  >
+        struct sequence_
+        {
+            using seq = index_sequence< t... >;
+        };
+
+
+        template<  typename... X  >
+        using index_sequence_for  =  typename __make_integer_seq<  sequence_,  unsigned,  sizeof...(X)  >::seq;
+
+
+#elif __has_builtin(__integer_pack)
+
+
+        template<  typename... X  >
+        using index_sequence_for  =  index_sequence<  __integer_pack(sizeof...(X))...  >;
+
+
+#else
+
+
+        template<  unsigned n,  typename  >
+        struct make_chain_;
+
+
+        template<  unsigned n,  unsigned... k  >
+        struct make_chain_<  n,  index_sequence< k... >  >
+        :   make_chain_<  n - 1,  index_sequence<  n - 1,  k...  >  >
+        { };
+
+
+        template<  unsigned... k  >
+        struct make_chain_<  0,  index_sequence< k... >  >
+        {
+            using result = index_sequence< k... >;
+        };
+
+
+        template<  typename... X  >
+        using index_sequence_for  =  typename make_chain_<  sizeof...(X),  index_sequence<>  >::result;
+
+#endif
+
+
+        template<  unsigned i,  typename Key,  typename X  >
+        struct slot {};
+
+
+        template<  typename Seq,  typename... Xs  >
+        struct table_;
+
+
+        template<  unsigned... i,  typename... Xs  >
+        struct table_<  index_sequence< i... >,  Xs...  >
+        :   slot<  i,  typename Xs::key,  Xs  >...
+        { };
+
+
+        template<  typename Key,  unsigned i,  typename X  >
+        static consteval unsigned index_(  slot< i, Key, X > const*  )  noexcept {  return i;  }
+
+
+        template<  typename Key,  unsigned i,  typename X  >
+        static consteval type_hull< X > type_(  slot< i, Key, X > const*  )  noexcept {  return {};  }
+    };
+
+
+
+    template<  typename... Xs  >
+    struct key_table
+    {
+    private:
+
+        using table_  =  key_table_::table_<  key_table_::index_sequence_for< Xs... >,  Xs...  >;
+
+
+    public:
+
+        template<  typename Key  >
+        static consteval auto index_of(  type_hull< Key >  )  noexcept
+        ->  decltype(  key_table_::index_< Key >(  static_cast< table_ const* >( nullptr )  )  )
+        {
+            return key_table_::index_< Key >(  static_cast< table_ const* >( nullptr )  );
+        }
+
+
+        template<  typename Key  >
+        using type  =  typename decltype(  key_table_::type_< Key >(  static_cast< table_ const* >( nullptr )  )  )::type;
+    };
+
+
+
     // the concept map_parameters< Xs... > is satisfied if and only if the following conditions hold:
     //
     // a)  The typename Xs::key  exists for all Xs...  .
     // b)  The typename Xs::value exists for all Xs... .
     // c)  The pack  "typename Xs::key..."  contains no duplicates.
     //
+    // c) is checked with one lookup per key in key_table< Xs... >.
+    //
     template<  typename... Xs  >
     concept  map_parameters  =
 
@@ -32,22 +164,7 @@ namespace lt
 
         ||
 
-
-        (   sizeof...(Xs)
-
-            ==
-
-            []( auto... keys  )
-            {
-                return
-                (   [](auto k,  auto... keys_)
-                    {
-                        return (unsigned( k == keys_ ) + ... );
-                    }
-                    ( keys,  keys... )  + ...
-                );
-            }(  type_hull<  typename Xs::key >{}...  )
-        )
+        requires {  (  key_table< Xs... >::index_of(  type_hull<  typename Xs::key  >{}  ),  ...  );  }
     );
 
 
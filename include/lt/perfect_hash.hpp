@@ -0,0 +1,322 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "lt/text.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+
+
+namespace lt
+{
+//  Perfect hashing of text keys:
+//
+//  perfect_hash< text<...>... > maps every key to its position in the parameter list
+//  (the id of the key) without collisions.  The table is built at compile time (hash and
+//  displace):  A string is hashed once (FNV-1a, 64 bit).  The high bits of the hash select
+//  one of about N/4 buckets,  the displacement of the bucket is mixed into the hash and
+//  the low bits select one of M >= 5N/4 slots.  The displacements are searched bucket by
+//  bucket, largest bucket first, until every key has a slot of its own;  if that fails,
+//  the strings are hashed again with the next of at most max_seeds_ seeds.
+//
+//  find( s ) costs one pass over s, two table reads and one comparison with the key in
+//  the slot;  it returns the id of s or size if s is not a key.  find is constexpr, so
+//  that ids can also be looked up at compile time.
+
+    template<  typename... Texts  >
+    struct perfect_hash_table_;
+
+
+
+    template<  typename... Texts  >
+    requires (  text_type< Texts >  &&  ...  )
+    struct perfect_hash
+    {
+        static constexpr std::size_t  size  =  sizeof...(Texts);
+
+
+    private:
+
+        static constexpr std::size_t  M  =  std::bit_ceil(  size + size / 4 + 1  );      // slots
+        static constexpr std::size_t  B  =  std::bit_ceil(  size / 4 + 1  );             // buckets
+
+        static constexpr int  bucket_shift_  =  64 - std::countr_zero( B );
+
+
+
+        template<  char... c  >
+        static consteval std::size_t length_(  text< c... >  )  noexcept
+        {
+            return sizeof...(c);
+        }
+
+
+        static constexpr std::size_t  chars_size_  =  (  length_( Texts{} )  +  ...  +  0  );
+
+
+
+        template<  char... c  >
+        static consteval void append_(  text< c... >,  char*  chars,  std::size_t&  n  )  noexcept
+        {
+            (  ( chars[ n++ ] = c ),  ...  );
+        }
+
+
+
+        static constexpr std::uint64_t hash_(  std::uint64_t seed,  char const*  p,  std::size_t  n  )  noexcept
+        {
+            std::uint64_t h  =  0xcbf29ce484222325ull ^ seed;
+
+            for ( std::size_t k = 0;  k != n;  ++k )
+                h  =  ( h ^ static_cast< unsigned char >( p[ k ] ) ) * 0x100000001b3ull;
+
+            return h;
+        }
+
+
+
+        static constexpr std::size_t slot_(  std::uint64_t h,  std::uint32_t d  )  noexcept   // fmix64 of MurmurHash3
+        {
+            h ^= d * 0x9e3779b97f4a7c15ull;
+
+            h ^= h >> 33;   h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33;   h *= 0xc4ceb9fe1a85ec53ull;
+            h ^= h >> 33;
+
+            return h & ( M - 1 );
+        }
+
+
+
+        static constexpr std::size_t bucket_(  std::uint64_t h  )  noexcept
+        {
+            if constexpr (  B == 1  )
+                return 0;
+            else
+                return h >> bucket_shift_;
+        }
+
+
+
+        struct table_
+        {
+            char           chars[ chars_size_ + 1 ]  =  {};
+            std::size_t    offset[ size + 1 ]        =  {};
+            std::uint64_t  seed                      =  0;
+            std::uint32_t  displacement[ B ]         =  {};
+            std::uint32_t  id[ M ]                   =  {};       // size:  empty slot
+            bool           distinct                  =  true;
+            bool           found                     =  false;
+        };
+
+
+
+        static consteval table_ keys_()
+        {
+            table_  t;
+
+            std::size_t n = 0;
+            std::size_t i = 0;
+            (  (  t.offset[ i++ ] = n,  append_(  Texts{},  t.chars,  n  )  ),  ...  );
+            t.offset[ size ] = n;
+
+            return t;
+        }
+
+
+
+        static constexpr std::string_view key_(  table_ const&  t,  std::size_t  id  )  noexcept
+        {
+            return {  t.chars + t.offset[ id ],  t.offset[ id + 1 ] - t.offset[ id ]  };
+        }
+
+
+
+        static constexpr std::uint64_t  max_seeds_  =  64;
+
+
+
+        //  The keys are sorted by bucket once per seed,  so that searching the displacement of
+        //  a bucket only visits the keys of this bucket.  The buckets are placed largest first.
+
+        static consteval table_ build_()
+        {
+            table_  t  =  keys_();
+
+            for ( ;  t.seed != max_seeds_;  ++t.seed )
+            {
+                std::uint64_t  h[ size + 1 ]          =  {};
+                std::size_t    begin[ B + 1 ]         =  {};        //  keys of bucket b:  key[ begin[ b ] ... begin[ b + 1 ] - 1 ]
+                std::size_t    key[ size + 1 ]        =  {};
+                std::size_t    next[ B + 1 ]          =  {};
+                std::size_t    by_count[ size + 2 ]   =  {};        //  number of buckets with more than c keys
+                std::size_t    order[ B ]             =  {};
+
+                for ( std::size_t k = 0;  k != size;  ++k )
+                {
+                    h[ k ]  =  hash_(  t.seed,  t.chars + t.offset[ k ],  t.offset[ k + 1 ] - t.offset[ k ]  );
+                    ++begin[ bucket_( h[ k ] ) + 1 ];
+                }
+
+                for ( std::size_t b = 0;  b != B;  ++b )
+                {
+                    ++by_count[ size - ( begin[ b + 1 ] ) ];            //  (count sort,  descending)
+                    begin[ b + 1 ] += begin[ b ];
+                    next[ b ] = begin[ b ];
+                }
+
+                for ( std::size_t k = 0;  k != size;  ++k )
+                    key[ next[ bucket_( h[ k ] ) ]++ ] = k;
+
+                for ( std::size_t b = 0;  b != B;  ++b )             //  equal keys share their bucket
+                    for ( std::size_t k = begin[ b ];  k != begin[ b + 1 ];  ++k )
+                        for ( std::size_t j = begin[ b ];  j != k;  ++j )
+                            if (  h[ key[ k ] ] == h[ key[ j ] ]  &&  key_( t, key[ k ] ) == key_( t, key[ j ] )  )
+                            {
+                                t.distinct = false;
+                                return t;
+                            }
+
+                for ( std::size_t c = 1;  c != size + 2;  ++c )
+                    by_count[ c ] += by_count[ c - 1 ];
+
+                for ( std::size_t b = B;  b-- != 0;  )
+                    order[ --by_count[ size - ( begin[ b + 1 ] - begin[ b ] ) ] ] = b;
+
+                for ( std::size_t s = 0;  s != M;  ++s )
+                    t.id[ s ] = size;
+
+                bool ok = true;
+
+                for ( std::size_t j = 0;  ok && j != B  &&  begin[ order[ j ] + 1 ] != begin[ order[ j ] ];  ++j )
+                    ok = place_(  t,  h,  key + begin[ order[ j ] ],  key + begin[ order[ j ] + 1 ],  order[ j ]  );
+
+                if ( ok )
+                {
+                    t.found = true;
+                    return t;
+                }
+            }
+
+            return t;
+        }
+
+
+
+        //  Searches the displacement of bucket b with the keys [ first, last ), such that all
+        //  of them land in distinct empty slots, and occupies the slots.
+
+        static consteval bool place_(  table_&  t
+                                    ,  std::uint64_t const*  h
+                                    ,  std::size_t const*    first
+                                    ,  std::size_t const*    last
+                                    ,  std::size_t           b
+                                    )
+        {
+            for ( std::uint32_t d = 0;  d != ( 1u << 16 );  ++d )
+            {
+                std::size_t  taken[ size + 1 ]  =  {};
+                std::size_t  n                  =  0;
+                bool         free               =  true;
+
+                for ( std::size_t const* k = first;  free && k != last;  ++k )
+                {
+                    std::size_t const s = slot_(  h[ *k ],  d  );
+
+                    free  =  t.id[ s ] == size;
+
+                    for ( std::size_t j = 0;  free && j != n;  ++j )
+                        free  =  taken[ j ] != s;
+
+                    taken[ n++ ] = s;
+                }
+
+                if ( free )
+                {
+                    n = 0;
+
+                    for ( std::size_t const* k = first;  k != last;  ++k )
+                        t.id[ taken[ n++ ] ] = static_cast< std::uint32_t >( *k );
+
+                    t.displacement[ b ] = d;
+
+                    return true;
+                }
+            }
+
+            return false;       // (next seed)
+        }
+
+
+
+        template<  typename...  >
+        friend struct perfect_hash_table_;
+
+
+
+    public:
+
+        static constexpr std::string_view key(  std::size_t  id  )  noexcept
+        {
+            constexpr table_ const&  table  =  perfect_hash_table_< Texts... >::value;
+
+            static_assert(  table.distinct,  "perfect_hash: the keys must be distinct"  );
+            static_assert(  table.found  ||  ! table.distinct,  "perfect_hash: no displacements found within max_seeds_ seeds"  );
+
+            return key_(  table,  id  );
+        }
+
+
+
+        static constexpr std::size_t find(  std::string_view  s  )  noexcept
+        {
+            if constexpr (  size == 0  )
+            {
+                return 0;
+            }
+            else
+            {
+                constexpr table_ const&  table  =  perfect_hash_table_< Texts... >::value;
+
+                static_assert(  table.distinct,  "perfect_hash: the keys must be distinct"  );
+                static_assert(  table.found  ||  ! table.distinct,  "perfect_hash: no displacements found within max_seeds_ seeds"  );
+
+                std::uint64_t const  h   =  hash_(  table.seed,  s.data(),  s.size()  );
+                std::uint32_t const  id  =  table.id[  slot_(  h,  table.displacement[ bucket_( h ) ]  )  ];
+
+                return  id != size  &&  key( id ) == s  ?  id  :  size;
+            }
+        }
+
+
+
+        template<  char... c  >
+        static constexpr std::size_t find(  text< c... >  )  noexcept
+        {
+            constexpr char  chars[]  =  {  c...,  '\0'  };
+
+            return find(  std::string_view(  chars,  sizeof...(c)  )  );
+        }
+    };
+
+
+
+    //  the table of perfect_hash< Texts... >,  built once perfect_hash is complete:
+
+    template<  typename... Texts  >
+    struct perfect_hash_table_
+    {
+        static constexpr auto  value  =  perfect_hash< Texts... >::build_();
+    };
+}
@@ -9,8 +9,16 @@
 
 #pragma once
 
-#include "lt/s_expr.hpp"
+#include "lt/s_types.hpp"
 #include "lt/map.hpp"
+#include "lt/type_system.hpp"
+
+#include <array>
+#include <cassert>
+#include <compare>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
 
 
 
@@ -36,11 +44,10 @@ namespace lt
 
 
 
-        template<  template<  typename...  > class  Reference_Seq_Tbl
-                ,  typename...                      Reference_Seq
-                >
-        constexpr entry_t(  Reference_Seq_Tbl<  Reference_Seq... > const&  tbl  )
-        :   entry_t(  nullptr, tbl.select_with_key( type_hull<Key>{} )  )
+        template<  typename Reference_Seq_Tbl  >
+        requires requires {  typename Reference_Seq_Tbl::template reference_seq_for< Key >;  }
+        constexpr entry_t(  Reference_Seq_Tbl const&  tbl  )
+        :   entry_t(  nullptr,  static_cast<  typename Reference_Seq_Tbl::template reference_seq_for< Key > const&  >( tbl )  )
         { }
 
 
@@ -174,6 +181,89 @@ namespace lt
 
 
 
+//  Bit-packed entries:
+//
+//  packed_entry_t< Key, bit_field< Value, bits > > holds a bool, integer or enum value that
+//  fits into bits bits,  as a two's complement number if the (underlying) type of Value is
+//  signed.  Assigning a value that does not fit is an error (asserted).  The packed entries
+//  of a record are stored jointly in the smallest unsigned word that holds all of them (in
+//  64 bit words, if they need more than 64 bits).  The mutable operator[] of the record
+//  returns a proxy that converts to Value and can be assigned from Value, the const
+//  operator[] returns a Value.
+
+    template<  typename Value,  unsigned bits  >
+    requires (  0 < bits  &&  bits <= 32  &&  (  std::is_integral_v< Value >  ||  std::is_enum_v< Value >  )  )
+    struct bit_field {};
+
+
+
+    template<  typename Key,  typename Bit_Field  >
+    struct packed_entry_t;
+
+
+
+    template<  typename Key,  typename Value,  unsigned n  >
+    struct packed_entry_t<  Key,  bit_field< Value, n >  >
+    {
+    private:
+
+        template<  typename... Entries  >
+        requires map_parameters< Entries... >
+        friend struct record;
+
+
+        template<  typename  Ignore  >
+        constexpr packed_entry_t( Ignore ) noexcept { }
+
+        constexpr packed_entry_t() = default;
+
+    public:
+
+        using key    =  Key;
+        using value  =  Value;
+
+        static constexpr unsigned bits  =  n;
+
+
+        constexpr packed_entry_t(packed_entry_t const&)  =  default;
+    };
+
+
+
+    template<  text<>::literal id,  typename T,  unsigned bits  >
+    using packed_entry = packed_entry_t<  value_type<operator""_text<id>()>,  bit_field< T, bits >  >;
+
+
+
+    template<  text<>::literal id  >
+    using bit_entry = packed_entry<  id,  bool,  1  >;
+
+
+
+//  record_columns, record_loader and binary_layout store every value at an address of
+//  its own and do not support packed entries:
+
+    template<  typename Entry  >
+    struct is_packed_entry_
+    {
+        enum { value = false };
+    };
+
+
+
+    template<  typename Key,  typename Bit_Field  >
+    struct is_packed_entry_<  packed_entry_t< Key, Bit_Field >  >
+    {
+        enum { value = true };
+    };
+
+
+
+    template<  typename... Entries  >
+    concept without_packed_entries  =  (  ! is_packed_entry_< Entries >::value  &&  ...  );
+
+
+
     inline constexpr struct
     {
     private:
@@ -268,7 +358,7 @@ namespace lt
         struct reference_seq
         :   Numbered_Reference...
         {
-            static constexpr type_hull<Key> key() { return {}; }
+            using key  =  Key;
 
 
             template<  typename... Ref  >
@@ -278,12 +368,6 @@ namespace lt
 
 
             reference_seq(reference_seq const&) = default;
-
-
-            constexpr reference_seq const&  select_with_key( type_hull<Key> )  const
-            {
-                return *this;
-            }
         };
 
 
@@ -347,16 +431,274 @@ namespace lt
         friend struct record;
 
 
+        template<  typename... Entries >
+        requires map_parameters< Entries... >
+        friend struct record_columns;
+
+
+        template<  typename... Entries >
+        requires map_parameters< Entries... >
+        friend struct packed_record;
+
+
 
         template<  typename... Reference_Seq  >
         struct reference_seq_tbl
         :   Reference_Seq...
         {
-            using Reference_Seq::select_with_key...;
-
             constexpr reference_seq_tbl(Reference_Seq const&... rs )
             :   Reference_Seq( rs )...
             { }
+
+
+            template<  typename Key  >
+            using reference_seq_for  =  typename key_table< Reference_Seq... >::template type< Key >;
+        };
+
+
+
+        template<  typename... Key  >
+        static constexpr std::array<  std::string_view,  sizeof...(Key)  >  key_names_  =  {  to_string_view< Key >...  };
+
+
+
+//  Storage of the packed entries:  bit_plan_of_< Entries... >() assigns the packed
+//  entries their bit offsets in declared order;  no entry crosses a 64 bit boundary.
+
+        template<  typename Entry  >
+        static consteval unsigned width_(  type_hull< Entry >  )  noexcept {  return 0;  }
+
+
+        template<  typename K,  typename V,  unsigned n  >
+        static consteval unsigned width_(  type_hull<  packed_entry_t<  K,  bit_field< V, n >  >  >  )  noexcept {  return n;  }
+
+
+
+        template<  typename Entry  >
+        static consteval bool fixed_(  type_hull< Entry >  )  noexcept {  return false;  }
+
+
+        template<  typename K,  typename V  >
+        static consteval bool fixed_(  type_hull<  fixed_entry_t< K, V >  >  )  noexcept {  return true;  }
+
+
+
+        template<  unsigned N  >
+        struct bit_plan_
+        {
+            unsigned offset[ N + 1 ];
+            unsigned total;
+        };
+
+
+
+        template<  typename... Entries  >
+        static consteval bit_plan_< sizeof...(Entries) >  bit_plan_of_()
+        {
+            unsigned const  width[] = {  width_(  type_hull< Entries >{}  )...,  0  };
+
+            bit_plan_< sizeof...(Entries) >  plan{};
+
+            unsigned position = 0;
+
+            for ( unsigned i = 0;  i != sizeof...(Entries);  ++i )
+            {
+                if ( width[ i ] == 0 )
+                    continue;
+
+                if ( position % 64 + width[ i ] > 64 )
+                    position = ( position + 63 ) / 64 * 64;
+
+                plan.offset[ i ] = position;
+                position += width[ i ];
+            }
+
+            plan.total = position;
+
+            return plan;
+        }
+
+
+
+        template<  unsigned total  >
+        static consteval auto word_()  noexcept
+        {
+            if constexpr ( total <= 8 )         return static_cast< std::uint8_t >( 0 );
+            else if constexpr ( total <= 16 )   return static_cast< std::uint16_t >( 0 );
+            else if constexpr ( total <= 32 )   return static_cast< std::uint32_t >( 0 );
+            else                                return static_cast< std::uint64_t >( 0 );
+        }
+
+
+
+        template<  unsigned total,  typename Word = decltype(  word_< total >()  )  >
+        struct bits_
+        {
+            Word  words_[ ( total + 63 ) / 64 ]  =  {};
+        };
+
+
+        template<  typename Word  >
+        struct bits_<  0,  Word  >
+        { };
+
+
+
+        template<  typename V,  typename Word,  unsigned offset,  unsigned n  >
+        struct bit_reference_
+        {
+            static constexpr unsigned  shift_  =  offset % ( 8 * sizeof(Word) );
+            static constexpr Word      mask_   =  static_cast< Word >(  ( ( std::uint64_t{1} << n ) - 1 ) << shift_  );
+
+
+            using underlying_  =  typename std::conditional_t<  std::is_enum_v< V >,  std::underlying_type< V >,  std::type_identity< V >  >::type;
+
+            static constexpr bool  signed_  =  std::is_signed_v< underlying_ >;
+
+
+            Word&  word_;
+
+
+            constexpr explicit bit_reference_(  Word&  word  )  noexcept
+            :   word_( word )
+            { }
+
+
+            constexpr bit_reference_(  bit_reference_ const&  )  noexcept  =  default;
+
+
+            constexpr operator V()  const noexcept
+            {
+                std::uint64_t const  raw  =  ( word_ & mask_ ) >> shift_;
+
+                if constexpr (  signed_  )          //  sign extension
+                    return static_cast< V >(  static_cast< underlying_ >(  static_cast< std::int64_t >( raw << ( 64 - n ) ) >> ( 64 - n )  )  );
+                else
+                    return static_cast< V >( raw );
+            }
+
+
+            constexpr bit_reference_&  operator=(  V v  )  noexcept
+            {
+                auto const  x  =  static_cast< underlying_ >( v );
+
+                if constexpr (  signed_  )
+                    assert(  -( std::int64_t{1} << ( n - 1 ) ) <= x  &&  x < ( std::int64_t{1} << ( n - 1 ) )  );
+                else
+                    assert(  static_cast< std::uint64_t >( x ) >> n == 0  );
+
+                std::uint64_t const  raw  =  static_cast< std::uint64_t >( x );
+
+                word_ = static_cast< Word >(  ( word_ & ~mask_ )  |  ( ( raw << shift_ ) & mask_ )  );
+                return *this;
+            }
+
+
+            constexpr bit_reference_&  operator=(  bit_reference_ const&  other  )  noexcept
+            {
+                return *this = static_cast< V >( other );
+            }
+        };
+
+
+
+        template<  typename V
+                ,  template<  typename, typename... > class  Reference_Seq
+                ,  typename                                  Key
+                ,  typename...                               Reference
+                >
+        static constexpr V make_(  Reference_Seq<  Key,  Reference... > const& rs  )
+        {
+            return V(  static_cast< Reference const& >(rs).get()...  );
+        }
+
+
+
+//  Access by key:  the entry is found with a single lookup in key_table< Entries... >.
+//  operator[] is a member of this small base, since instantiating a member template of
+//  the record itself costs time proportional to the number of entries.  The base also
+//  holds the words of the packed entries.
+
+        template<  typename Record,  typename Keys,  auto plan  >
+        struct access_
+        :   bits_<  plan.total  >
+        {
+        private:
+
+            friend Record;
+
+
+            static constexpr bool  packed_  =  plan.total != 0;
+
+
+            template<  typename K  >
+            using entry_  =  typename Keys::template type< K >;
+
+
+            template<  typename K,  typename Word  >
+            constexpr auto  bit_reference_of_(  type_hull< K >,  Word* words  )  const noexcept
+            {
+                constexpr unsigned  offset  =  plan.offset[ Keys::index_of( type_hull< K >{} ) ];
+
+                return bit_reference_<  typename entry_< K >::value,  Word,  offset,  entry_< K >::bits  >{  words[ offset / 64 ]  };
+            }
+
+
+
+            template<  typename K,  typename X  >
+            constexpr void assign_(  type_hull< K >  k,  X&& x  )
+            {
+                if constexpr (  ! fixed_(  type_hull<  entry_< K >  >{}  )  )
+                    (*this)[ k ] = static_cast< X&& >( x );
+            }
+
+
+
+            template<  typename Entry,  typename Tbl  >
+            constexpr void init_(  type_hull< Entry >,  Tbl const& tbl  )
+            {
+                if constexpr (  width_(  type_hull< Entry >{}  ) != 0  )
+                {
+                    using key  =  typename Entry::key;
+
+                    (*this)[ type_hull< key >{} ]  =  make_< typename Entry::value >(  static_cast<  typename Tbl::template reference_seq_for< key > const&  >( tbl )  );
+                }
+            }
+
+
+        public:
+
+            template<  typename K  >
+            requires requires {  typename Keys::template type< K >;  }
+            constexpr decltype(auto) operator[](  type_hull< K > k  ) const &
+            {
+                if constexpr (  width_(  type_hull<  entry_< K >  >{}  ) != 0  )
+                    return static_cast<  typename entry_< K >::value  >(  bit_reference_of_(  k,  this->words_  )  );
+                else
+                    return static_cast<  entry_< K > const&  >(  static_cast< Record const& >( *this )  )[ k ];
+            }
+
+
+            template<  typename K  >
+            requires requires {  typename Keys::template type< K >;  }
+            constexpr decltype(auto) operator[](  type_hull< K > k  ) &
+            {
+                if constexpr (  width_(  type_hull<  entry_< K >  >{}  ) != 0  )
+                    return bit_reference_of_(  k,  this->words_  );
+                else
+                    return static_cast<  entry_< K >&  >(  static_cast< Record& >( *this )  )[ k ];
+            }
+
+
+            template<  typename K  >
+            requires requires {  typename Keys::template type< K >;  }
+            constexpr decltype(auto) operator[](  type_hull< K > k  ) &&
+            {
+                if constexpr (  width_(  type_hull<  entry_< K >  >{}  ) != 0  )
+                    return static_cast<  typename entry_< K >::value  >(  bit_reference_of_(  k,  this->words_  )  );
+                else
+                    return static_cast<  entry_< K >&&  >(  static_cast< Record&& >( *this )  )[ k ];
+            }
         };
 
 
@@ -428,6 +770,52 @@ namespace lt
         }
 
 
+//  field-wise comparison;  fixed entries do not take part:
+
+        template<  typename K,  typename V,  typename Record  >
+        static constexpr bool equal_(  type_hull<  entry_t< K, V >  >,  Record const&  x,  Record const&  y  )
+        {
+            return x[ type_hull< K >{} ] == y[ type_hull< K >{} ];
+        }
+
+
+        template<  typename K,  typename V,  unsigned n,  typename Record  >
+        static constexpr bool equal_(  type_hull<  packed_entry_t<  K,  bit_field< V, n >  >  >,  Record const&  x,  Record const&  y  )
+        {
+            return x[ type_hull< K >{} ] == y[ type_hull< K >{} ];
+        }
+
+
+        template<  typename Entry,  typename Record  >
+        static constexpr bool equal_(  type_hull< Entry >,  Record const&,  Record const&  )  noexcept
+        {
+            return true;
+        }
+
+
+
+        template<  typename K,  typename V,  typename Record  >
+        static constexpr auto compare_(  type_hull<  entry_t< K, V >  >,  Record const&  x,  Record const&  y  )
+        {
+            return x[ type_hull< K >{} ] <=> y[ type_hull< K >{} ];
+        }
+
+
+        template<  typename K,  typename V,  unsigned n,  typename Record  >
+        static constexpr auto compare_(  type_hull<  packed_entry_t<  K,  bit_field< V, n >  >  >,  Record const&  x,  Record const&  y  )
+        {
+            return x[ type_hull< K >{} ] <=> y[ type_hull< K >{} ];
+        }
+
+
+        template<  typename Entry,  typename Record  >
+        static constexpr std::strong_ordering compare_(  type_hull< Entry >,  Record const&,  Record const&  )  noexcept
+        {
+            return std::strong_ordering::equal;
+        }
+
+
+
         template<  typename  >
         struct eval_;
 
@@ -523,6 +911,17 @@ namespace lt
         constexpr record&  operator<<=( record const& ) noexcept { return *this; }
 
 
+        constexpr bool operator==( record const& ) const noexcept { return true; }
+
+        constexpr std::strong_ordering operator<=>( record const& ) const noexcept { return std::strong_ordering::equal; }
+
+
+        static constexpr std::array< std::string_view, 0 > const&  key_names()  noexcept
+        {
+            return key_names_<>;
+        }
+
+
 
 
         constexpr record const& constant() noexcept
@@ -600,14 +999,29 @@ namespace lt
     requires
         map_parameters<  Entry_t< Key, Value >...  >
     struct record<  Entry_t< Key, Value >...  >
-    :   Entry_t< Key, Value >...
+    :   record<>::template access_<  record<  Entry_t< Key, Value >...  >
+                                   ,  key_table<  Entry_t< Key, Value >...  >
+                                   ,  record<>::template bit_plan_of_<  Entry_t< Key, Value >...  >()
+                                   >
+    ,   Entry_t< Key, Value >...
     {
     private:
 
+        using access_  =  record<>::template access_<  record
+                                                   ,  key_table<  Entry_t< Key, Value >...  >
+                                                   ,  record<>::template bit_plan_of_<  Entry_t< Key, Value >...  >()
+                                                   >;
+
+
         template<  typename... Ref_Seq  >
         constexpr  record( record<>::template reference_seq_tbl< Ref_Seq... > const& tbl )
         :   Entry_t< Key, Value >( tbl )...
-        { }
+        {
+            if constexpr (  access_::packed_  )
+            {
+                (  access_::init_(  type_hull<  Entry_t< Key, Value >  >{},  tbl  ),  ...  );
+            }
+        }
 
 
     public:
@@ -625,13 +1039,15 @@ namespace lt
         requires
         (
             sizeof...(Constructor) != 0
+            &&
+            requires(  Constructor... c  ) {  (  c(),  ...  );  }
         )
         constexpr record(  Constructor... c )
         :   record(  record<>::template reference_seq_tbl< decltype(c())... >( c()... ) )
         { }
 
 
-        using Entry_t<Key, Value>::operator[]...;
+        using access_::operator[];
 
 
 
@@ -735,34 +1151,202 @@ namespace lt
 
 
 
+//  The names of the keys in declared order,  e.g. for serialization.  The array is a
+//  static constant, i.e. nothing is built at runtime:
+
+        static constexpr std::array<  std::string_view,  sizeof...(Key)  > const&  key_names()  noexcept
+        requires (  text_type< Key >  &&  ...  )
+        {
+            return record<>::template key_names_< Key... >;
+        }
 
 
-        template<  template< typename... > class  E
-                ,  typename...                    K
-                ,  typename...                    V
-                >
-        constexpr record& operator<<=( record< E< K, V >... > const&  other )
+
+
+
+
+//  Comparison of the stored values in declared order; fixed entries are ignored:
+
+        constexpr bool operator==(  record const&  other  )  const
         {
-            if ( this != &other ) [[likely]]
+            return ( record<>::equal_(  type_hull<  Entry_t< Key, Value >  >{},  *this,  other  )  &&  ...  );
+        }
+
+
+
+        constexpr auto operator<=>(  record const&  other  )  const
+        {
+            std::common_comparison_category_t<
+                decltype(  record<>::compare_(  type_hull<  Entry_t< Key, Value >  >{},  *this,  other  )  )...
+            >
+            result = std::strong_ordering::equal;
+
+            static_cast<void>(
+                (  (  ( result = record<>::compare_(  type_hull<  Entry_t< Key, Value >  >{},  *this,  other  ) ) == 0  )  &&  ...  )
+            );
+
+            return result;
+        }
+
+
+
+//  Assignment of the shared keys;  fixed entries of *this are left alone:
+
+        template<  typename... Entries  >
+        constexpr record& operator<<=( record< Entries... > const&  other )
+        {
+            if ( static_cast< void const* >(this) != static_cast< void const* >(&other) ) [[likely]]
             {
-                ( ((*this)[ type_hull<K>{} ] = other[ type_hull<K>{} ]), ... );
+                ( access_::assign_(  type_hull< typename Entries::key >{},  other[ type_hull< typename Entries::key >{} ]  ), ... );
             }
             return *this;
         }
 
 
 
-        template<  template< typename... > class  E
-                ,  typename...                    K
-                ,  typename...                    V
-                >
-        constexpr record& operator<<=( record< E< K, V >... >&&  other )
+        template<  typename... Entries  >
+        constexpr record& operator<<=( record< Entries... >&&  other )
         {
-            if ( this != &other ) [[likely]]
+            if ( static_cast< void const* >(this) != static_cast< void const* >(&other) ) [[likely]]
             {
-                ( ((*this)[ type_hull<K>{} ] = other.move()[ type_hull<K>{} ]), ... );
+                ( access_::assign_(  type_hull< typename Entries::key >{},  other.move()[ type_hull< typename Entries::key >{} ]  ), ... );
             }
             return *this;
         }
     };
+
+
+
+//  Padding-minimizing layout:
+//
+//  optimal_layout< Entries... > is the record whose entries are stored by descending
+//  alignment (stable, i.e. entries with equal alignment keep their declared order).
+//  Since the size of a type is a multiple of its alignment, no padding is needed
+//  between the entries.
+//
+//  packed_record< Entries... > uses the storage of optimal_layout< Entries... >,
+//  but keeps the declared order where order is observable: invoke passes the values
+//  in declared order.  Access by key and operator<<= are independent of the order.
+
+    template<  typename... Entries  >
+    requires map_parameters< Entries... >
+    using optimal_layout  =  ts_rep::sort_types_by<  combinator<  1,  ts_rep::alignof_  >,  record< Entries... >  >;
+
+
+
+    template<  typename... Entries  >
+    requires map_parameters< Entries... >
+    struct packed_record;
+
+
+
+    template<  typename...                        Key
+            ,  typename...                        Value
+            ,  template<  typename... > class...  Entry_t
+            >
+    requires
+        map_parameters<  Entry_t< Key, Value >...  >
+    struct packed_record<  Entry_t< Key, Value >...  >
+    :   optimal_layout<  Entry_t< Key, Value >...  >
+    {
+    private:
+
+        using layout_  =  optimal_layout<  Entry_t< Key, Value >...  >;
+
+
+    public:
+
+        using layout_::layout_;
+
+
+        constexpr packed_record()                        =  default;
+        constexpr packed_record( packed_record const& )  =  default;
+        constexpr packed_record( packed_record&& )       =  default;
+
+
+        constexpr packed_record& operator=( packed_record const& )  =  default;
+        constexpr packed_record& operator=( packed_record&& )       =  default;
+
+
+
+        constexpr packed_record const& constant() const noexcept
+        {
+            return *this;
+        }
+
+
+        constexpr packed_record&& move() noexcept
+        {
+            return static_cast<packed_record&&>(*this);
+        }
+
+
+        constexpr packed_record const& forward() const& noexcept
+        {
+            return *this;
+        }
+
+
+        constexpr packed_record& forward() & noexcept
+        {
+            return *this;
+        }
+
+
+        constexpr packed_record&& forward() && noexcept
+        {
+            return static_cast<packed_record&&>(*this);
+        }
+
+
+
+        constexpr decltype(auto) invoke(auto&& f) const&
+        {
+            return f( constant()[ type_hull<Key>() ]... );
+        }
+
+
+        constexpr decltype(auto) invoke(auto&& f) &
+        {
+            return f( (*this)[ type_hull<Key>() ]... );
+        }
+
+
+        constexpr decltype(auto) invoke(auto&& f) &&
+        {
+            return f( move()[ type_hull<Key>() ]... );
+        }
+
+
+
+        constexpr bool operator==(  packed_record const&  other  )  const
+        {
+            return static_cast< layout_ const& >( *this ) == other;
+        }
+
+
+
+        constexpr auto operator<=>(  packed_record const&  other  )  const       // in declared order
+        {
+            std::common_comparison_category_t<
+                decltype(  record<>::compare_(  type_hull<  Entry_t< Key, Value >  >{},  *this,  other  )  )...
+            >
+            result = std::strong_ordering::equal;
+
+            static_cast<void>(
+                (  (  ( result = record<>::compare_(  type_hull<  Entry_t< Key, Value >  >{},  *this,  other  ) ) == 0  )  &&  ...  )
+            );
+
+            return result;
+        }
+
+
+
+        template<  typename Record  >
+        constexpr packed_record& operator<<=(  Record&& other  )
+        {
+            layout_::operator<<=( static_cast< Record&& >(other) );
+            return *this;
+        }
+    };
 }
@@ -0,0 +1,503 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "lt/record.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+
+
+namespace lt
+{
+//  record_columns< Entries... > stores a sequence of record< Entries... > column by
+//  column (structure of arrays):  The values of every entry_t< Key, Value > are kept
+//  in a contiguous array that is accessible as a span with column( type_hull<Key> ).
+//  Fixed entries have no storage.  (The arrays are not std::vector, since the
+//  elements of std::vector<bool> are not addressable.)
+//
+//  columns[ n ] is a proxy for the n-th record with the key-based operator[] and
+//  invoke of record< Entries... >.  It converts to record< Entries... >.
+//
+//  columns.eval( Program{}, out ) evaluates Program for every record and stores the
+//  n-th result in out[ n ].  The column pointers are loaded once before the loop, so
+//  that elementwise arithmetic is a loop over plain arrays.
+
+    template<  typename... Entries  >
+    requires map_parameters< Entries... >
+    struct record_columns;
+
+
+
+    template<  typename...                        Key
+            ,  typename...                        Value
+            ,  template<  typename... > class...  Entry_t
+            >
+    requires
+        map_parameters<  Entry_t< Key, Value >...  >  &&  without_packed_entries<  Entry_t< Key, Value >...  >
+    struct record_columns<  Entry_t< Key, Value >...  >
+    {
+    private:
+
+        //  Only the first size_ elements of the capacity are constructed,  hence growing
+        //  costs size_ moves and V need not be default constructible.
+
+        template<  typename V  >
+        struct array_
+        {
+            V*           data_      =  nullptr;
+            std::size_t  size_      =  0;
+            std::size_t  capacity_  =  0;
+
+
+            static V* allocate_(  std::size_t n  )
+            {
+                return  n == 0  ?  nullptr  :  std::allocator< V >{}.allocate( n );
+            }
+
+
+            static void deallocate_(  V*  data,  std::size_t n  )  noexcept
+            {
+                if ( data != nullptr )
+                    std::allocator< V >{}.deallocate(  data,  n  );
+            }
+
+
+            array_()  =  default;
+
+
+            array_(  array_ const&  other  )
+            :   data_(  allocate_( other.size_ )  )
+            ,   capacity_(  other.size_  )
+            {
+                try
+                {
+                    std::uninitialized_copy_n(  other.data_,  other.size_,  data_  );
+                }
+                catch ( ... )
+                {
+                    deallocate_(  data_,  capacity_  );
+                    throw;
+                }
+
+                size_ = other.size_;
+            }
+
+
+            array_(  array_&&  other  )  noexcept
+            :   data_(  other.data_  )
+            ,   size_(  other.size_  )
+            ,   capacity_(  other.capacity_  )
+            {
+                other.data_      =  nullptr;
+                other.size_      =  0;
+                other.capacity_  =  0;
+            }
+
+
+            array_& operator=(  array_  other  )  noexcept
+            {
+                auto const data      =  data_;
+                auto const size      =  size_;
+                auto const capacity  =  capacity_;
+
+                data_      =  other.data_;
+                size_      =  other.size_;
+                capacity_  =  other.capacity_;
+
+                other.data_      =  data;
+                other.size_      =  size;
+                other.capacity_  =  capacity;
+
+                return *this;
+            }
+
+
+            ~array_()
+            {
+                clear();
+                deallocate_(  data_,  capacity_  );
+            }
+
+
+            void clear()  noexcept
+            {
+                std::destroy_n(  data_,  size_  );
+                size_ = 0;
+            }
+
+
+            void reserve(  std::size_t n  )
+            {
+                if ( n > capacity_ )
+                {
+                    V* const  data  =  allocate_( n );
+
+                    try         //  (moves only if that cannot throw or if V cannot be copied)
+                    {
+                        if constexpr (  std::is_nothrow_move_constructible_v< V >  ||  ! std::is_copy_constructible_v< V >  )
+                            std::uninitialized_move_n(  data_,  size_,  data  );
+                        else
+                            std::uninitialized_copy_n(  data_,  size_,  data  );
+                    }
+                    catch ( ... )
+                    {
+                        deallocate_(  data,  n  );
+                        throw;
+                    }
+
+                    std::destroy_n(  data_,  size_  );
+                    deallocate_(  data_,  capacity_  );
+
+                    data_      =  data;
+                    capacity_  =  n;
+                }
+            }
+
+
+            void grow(  std::size_t n  )       //  reserves geometrically
+            {
+                if ( n > capacity_ )
+                    reserve(  std::max(  n,  capacity_ == 0  ?  16  :  2 * capacity_  )  );
+            }
+
+
+            template<  typename X  >
+            void push_back(  X&& x  )
+            {
+                grow(  size_ + 1  );
+
+                std::construct_at(  data_ + size_,  static_cast< X&& >( x )  );
+                ++size_;
+            }
+
+
+            void pop_back()  noexcept
+            {
+                std::destroy_at(  data_ + --size_  );
+            }
+        };
+
+
+
+        template<  typename Entry  >
+        struct column_;
+
+
+
+        template<  typename K,  typename V  >
+        struct column_<  entry_t< K, V >  >
+        {
+            array_< V >  values_;
+
+
+            V&        at_(  type_hull< K >,  std::size_t n  )        noexcept {  return values_.data_[ n ];  }
+            V const&  at_(  type_hull< K >,  std::size_t n  )  const  noexcept {  return values_.data_[ n ];  }
+
+
+            std::span< V >        column(  type_hull< K >  )        noexcept {  return {  values_.data_,  values_.size_  };  }
+            std::span< V const >  column(  type_hull< K >  )  const  noexcept {  return {  values_.data_,  values_.size_  };  }
+
+
+            template<  typename X  >
+            void push_(  type_hull< K >,  X&& x  )  {  values_.push_back(  static_cast< X&& >( x )  );  }
+
+            void reserve_(  std::size_t n  )  {  values_.reserve( n );  }
+
+            void grow_(  std::size_t n  )  {  values_.grow( n );  }
+
+            void pop_()  noexcept {  values_.pop_back();  }
+
+            void clear_()  noexcept {  values_.clear();  }
+        };
+
+
+
+        template<  typename K,  typename V  >
+        struct column_<  fixed_entry_t< K, V >  >
+        {
+            constexpr auto  at_(  type_hull< K >,  std::size_t  )  const
+            {
+                return record<  fixed_entry_t< K, V >  >{}[ type_hull< K >{} ];
+            }
+
+
+            void column(  type_hull< K >  )  const  =  delete;
+
+
+            template<  typename X  >
+            void push_(  type_hull< K >,  X&&  )  noexcept {  }
+
+            void reserve_(  std::size_t  )  noexcept {  }
+
+            void grow_(  std::size_t  )  noexcept {  }
+
+            void pop_()  noexcept {  }
+
+            void clear_()  noexcept {  }
+        };
+
+
+
+        struct storage_
+        :   column_<  Entry_t< Key, Value >  >...
+        {
+            using column_<  Entry_t< Key, Value >  >::at_...;
+            using column_<  Entry_t< Key, Value >  >::column...;
+            using column_<  Entry_t< Key, Value >  >::push_...;
+        };
+
+
+
+        storage_     columns_;
+        std::size_t  size_ = 0;
+
+
+
+        template<  typename Entry  >
+        struct load_;
+
+
+
+        template<  typename K,  typename V  >
+        struct load_<  entry_t< K, V >  >
+        {
+            V const*  data_;
+
+
+            explicit load_(  storage_ const&  s  )  noexcept
+            :   data_(  s.column( type_hull< K >{} ).data()  )
+            { }
+
+
+            V const&  at_(  type_hull< K >,  std::size_t n  )  const  noexcept {  return data_[ n ];  }
+        };
+
+
+
+        template<  typename K,  typename V  >
+        struct load_<  fixed_entry_t< K, V >  >
+        :   column_<  fixed_entry_t< K, V >  >
+        {
+            explicit load_(  storage_ const&  )  noexcept { }
+        };
+
+
+
+        struct loads_
+        :   load_<  Entry_t< Key, Value >  >...
+        {
+            using load_<  Entry_t< Key, Value >  >::at_...;
+
+
+            explicit loads_(  storage_ const&  s  )  noexcept
+            :   load_<  Entry_t< Key, Value >  >( s )...
+            { }
+        };
+
+
+
+        struct cursor_
+        {
+            loads_ const&  loaded_;
+            std::size_t    n_;
+
+
+            template<  typename K  >
+            decltype(auto)  operator[](  type_hull< K >  k  )  const
+            {
+                return loaded_.at_(  k,  n_  );
+            }
+
+
+            cursor_ const&  constant()  const noexcept {  return *this;  }
+            cursor_ const&  forward()   const noexcept {  return *this;  }
+        };
+
+
+
+        template<  typename Columns  >
+        struct row_
+        {
+            Columns*     columns_;
+            std::size_t  n_;
+
+
+            template<  typename K  >
+            constexpr decltype(auto)  operator[](  type_hull< K >  k  )  const
+            {
+                return columns_->columns_.at_(  k,  n_  );
+            }
+
+
+            constexpr decltype(auto)  invoke(  auto&& f  )  const
+            {
+                return f(  (*this)[ type_hull< Key >{} ]...  );
+            }
+
+
+            constexpr operator record<  Entry_t< Key, Value >...  >()  const
+            {
+                return record<  Entry_t< Key, Value >...  >{  argument(  type_hull< Key >{},  (*this)[ type_hull< Key >{} ]  )...  };
+            }
+        };
+
+
+
+        //  push_row_:  all columns grow before the first value is pushed,  and the values that
+        //  are already pushed are removed if a later one throws,  so the columns stay aligned.
+
+        template<  typename Get  >
+        void push_row_(  Get const&  get  )
+        {
+            ( static_cast<  column_<  Entry_t< Key, Value >  >&  >( columns_ ).grow_(  size_ + 1  ), ... );
+
+            std::size_t  pushed  =  0;
+
+            try
+            {
+                ( ( columns_.push_(  type_hull< Key >{},  get( type_hull< Key >{} )  ),  ++pushed ), ... );
+            }
+            catch ( ... )
+            {
+                std::size_t  k  =  0;
+
+                ( ( k++ < pushed  ?  static_cast<  column_<  Entry_t< Key, Value >  >&  >( columns_ ).pop_()  :  void() ), ... );
+                throw;
+            }
+
+            ++size_;
+        }
+
+
+
+    public:
+
+        using row        =  row_<  record_columns  >;
+        using const_row  =  row_<  record_columns const  >;
+
+
+
+        record_columns()  =  default;
+
+        record_columns(  record_columns const&  )  =  default;
+
+
+        record_columns(  record_columns&&  other  )  noexcept
+        :   columns_(  static_cast< storage_&& >( other.columns_ )  )
+        ,   size_(  other.size_  )
+        {
+            other.size_ = 0;
+        }
+
+
+        record_columns& operator=(  record_columns  other  )  noexcept
+        {
+            columns_  =  static_cast< storage_&& >( other.columns_ );
+            size_     =  other.size_;
+
+            return *this;
+        }
+
+
+
+        std::size_t size()  const noexcept {  return size_;  }
+
+        bool empty()  const noexcept {  return size_ == 0;  }
+
+
+
+        void reserve(  std::size_t n  )
+        {
+            ( static_cast<  column_<  Entry_t< Key, Value >  >&  >( columns_ ).reserve_( n ), ... );
+        }
+
+
+
+        void clear()  noexcept       // keeps the capacity
+        {
+            ( static_cast<  column_<  Entry_t< Key, Value >  >&  >( columns_ ).clear_(), ... );
+            size_ = 0;
+        }
+
+
+
+        void push_back(  record<  Entry_t< Key, Value >...  > const&  r  )
+        {
+            push_row_(  [&]( auto k ) -> decltype(auto) {  return r[ k ];  }  );
+        }
+
+
+
+        void push_back(  record<  Entry_t< Key, Value >...  >&&  r  )
+        {
+            push_row_(  [&]( auto k ) -> decltype(auto) {  return r.move()[ k ];  }  );
+        }
+
+
+
+        row        operator[](  std::size_t n  )        noexcept {  return row{  this,  n  };  }
+        const_row  operator[](  std::size_t n  )  const  noexcept {  return const_row{  this,  n  };  }
+
+
+
+        template<  typename Program,  typename Out  >
+        void eval(  Program,  Out&&  out  )  const
+        {
+            loads_ const  loads(  columns_  );
+
+            for ( std::size_t n = 0;  n != size_;  ++n )
+                out[ n ] = record<>::template eval_< Program >::template apply_to(  cursor_{  loads,  n  }  );
+        }
+
+
+
+        template<  typename K  >
+        auto column(  type_hull< K >  k  )  noexcept
+        ->  decltype(  columns_.column( k )  )
+        {
+            return columns_.column( k );
+        }
+
+
+
+        template<  typename K  >
+        auto column(  type_hull< K >  k  )  const noexcept
+        ->  decltype(  columns_.column( k )  )
+        {
+            return columns_.column( k );
+        }
+    };
+
+
+
+//  eval_batch( Program{}, records, out ) stores the result of Program for the n-th
+//  element of records in out[ n ].  records is a range of records or record_columns.
+
+    template<  typename Program,  typename Records,  typename Out  >
+    void eval_batch(  Program  program,  Records const&  records,  Out&&  out  )
+    {
+        if constexpr (  requires {  records.eval(  program,  out  );  }  )
+        {
+            records.eval(  program,  out  );
+        }
+        else
+        {
+            std::size_t n = 0;
+
+            for ( auto const& r : records )
+                out[ n++ ] = r.eval( program );
+        }
+    }
+}
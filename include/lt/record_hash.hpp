@@ -0,0 +1,146 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "lt/record.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+
+
+namespace lt
+{
+//  Hashing of records:
+//
+//  record_hash hashes the stored values of a record, including packed entries;  fixed
+//  entries do not take part, in accordance with record::operator==.  If the object
+//  representation of the record is unique (trivially copyable values without padding,
+//  see std::has_unique_object_representations) and all entries are plain entries, the
+//  record is hashed as one block of bytes.  Otherwise the std::hash values of the stored
+//  entries are combined in declared order.
+
+    struct record_hash
+    {
+    private:
+
+        static constexpr std::uint64_t  k1_  =  0x9e3779b97f4a7c15ull;
+        static constexpr std::uint64_t  k2_  =  0xff51afd7ed558ccdull;
+
+
+
+        static constexpr std::uint64_t mix_(  std::uint64_t h,  std::uint64_t x  )  noexcept
+        {
+            h  =  ( h ^ ( x * k1_ ) ) * k2_;
+            return  ( h << 29 ) | ( h >> 35 );
+        }
+
+
+
+        static constexpr std::uint64_t finish_(  std::uint64_t h  )  noexcept   // fmix64 of MurmurHash3
+        {
+            h ^= h >> 33;   h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33;   h *= 0xc4ceb9fe1a85ec53ull;
+            h ^= h >> 33;
+
+            return h;
+        }
+
+
+
+        static std::uint64_t bytes_(  unsigned char const*  p,  std::size_t  n  )  noexcept
+        {
+            std::uint64_t h = n;
+
+            for ( ;  n >= 8;  p += 8,  n -= 8 )
+            {
+                std::uint64_t w;
+                std::memcpy(  &w,  p,  8  );
+                h = mix_( h,  w );
+            }
+
+            if ( n != 0 )
+            {
+                std::uint64_t w = 0;
+                std::memcpy(  &w,  p,  n  );
+                h = mix_( h,  w );
+            }
+
+            return finish_( h );
+        }
+
+
+
+        template<  typename K,  typename V,  typename Record  >
+        static std::uint64_t field_(  type_hull<  entry_t< K, V >  >,  std::uint64_t h,  Record const&  r  )
+        {
+            return mix_(  h,  std::hash< V >{}(  r[ type_hull< K >{} ]  )  );
+        }
+
+
+        template<  typename K,  typename V,  unsigned n,  typename Record  >
+        static std::uint64_t field_(  type_hull<  packed_entry_t<  K,  bit_field< V, n >  >  >,  std::uint64_t h,  Record const&  r  )
+        {
+            return mix_(  h,  std::hash< V >{}(  r[ type_hull< K >{} ]  )  );
+        }
+
+
+        template<  typename Entry,  typename Record  >
+        static std::uint64_t field_(  type_hull< Entry >,  std::uint64_t h,  Record const&  )  noexcept
+        {
+            return h;
+        }
+
+
+
+    public:
+
+        template<  typename...                        Key
+                ,  typename...                        Value
+                ,  template<  typename... > class...  Entry_t
+                >
+        std::size_t operator()(  record<  Entry_t< Key, Value >...  > const&  r  )  const
+        {
+            if constexpr (  std::has_unique_object_representations_v<  record<  Entry_t< Key, Value >...  >  >
+                            &&
+                            (  ( type_hull<  Entry_t< Key, Value >  >{}  ==  type_hull<  entry_t< Key, Value >  >{} )  &&  ...  )
+                         )
+            {
+                return bytes_(  reinterpret_cast< unsigned char const* >( &r ),  sizeof( r )  );
+            }
+            else
+            {
+                std::uint64_t h = sizeof...(Key);
+
+                (  ( h = field_(  type_hull<  Entry_t< Key, Value >  >{},  h,  r  ) ),  ...  );
+
+                return finish_( h );
+            }
+        }
+
+    };
+}
+
+
+
+template<  typename...                        Key
+        ,  typename...                        Value
+        ,  template<  typename... > class...  Entry_t
+        >
+struct std::hash<  lt::record<  Entry_t< Key, Value >...  >  >
+{
+    std::size_t operator()(  lt::record<  Entry_t< Key, Value >...  > const&  r  )  const
+    {
+        return lt::record_hash{}( r );
+    }
+};
@@ -0,0 +1,367 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "lt/record.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+
+
+namespace lt
+{
+//  Binary layout of records:
+//
+//  binary_layout< record< Entries... > > describes the serialized form of a record whose
+//  entries have text keys and trivially copyable values.  The stored entries are laid
+//  out in lexicographic order of their keys, i.e. independently of the declaration
+//  order, each at an offset that is a multiple of its alignment.  Fixed entries are not
+//  stored, packed entries are not supported.  Values are stored in the byte order of the
+//  host;  padding bytes are zero.
+//
+//  binary_layout::hash identifies the layout (keys, sizes, alignments, arithmetic kinds
+//  and offsets of the stored entries) and is meant to be shipped along with the data.
+//
+//  write_to( r, buffer ) writes r into the first binary_layout::size bytes of buffer and
+//  returns their number,  or writes nothing and returns 0 if buffer is shorter.
+//  record_view< record< Entries... > > reads single values in place from such a buffer,
+//  e.g. from a memory mapped file.  The buffer does not need to be aligned,  but it must
+//  hold at least binary_layout::size bytes (asserted).
+
+    template<  typename Record  >
+    struct binary_layout;
+
+
+
+    template<  typename...                        Key
+            ,  typename...                        Value
+            ,  template<  typename... > class...  Entry_t
+            >
+    requires
+    (
+        without_packed_entries<  Entry_t< Key, Value >...  >
+        &&
+        (  (  type_hull<  Entry_t< Key, Value >  >{}  ==  type_hull<  fixed_entry_t< Key, Value >  >{}
+              ||
+              (  type_hull<  Entry_t< Key, Value >  >{}  ==  type_hull<  entry_t< Key, Value >  >{}
+                 &&
+                 std::is_trivially_copyable_v< Value >
+              )
+           )  &&  ...
+        )
+    )
+    struct binary_layout<  record<  Entry_t< Key, Value >...  >  >
+    {
+    private:
+
+        template<  typename K  >
+        struct name_;
+
+
+
+        template<  char... c  >
+        struct name_<  text< c... >  >
+        {
+            static constexpr char value[] = {  c...,  '\0'  };
+        };
+
+
+
+        template<  typename V  >
+        static consteval std::uint64_t kind_()
+        {
+            if constexpr (  std::is_same_v< V, bool >  )         return 1;
+            else if constexpr (  std::is_floating_point_v< V >  )  return 2;
+            else if constexpr (  std::is_signed_v< V >  )          return 3;
+            else if constexpr (  std::is_unsigned_v< V >  )        return 4;
+            else                                                    return 0;
+        }
+
+
+
+        struct field_
+        {
+            char const*    name;
+            std::size_t    size;
+            std::size_t    alignment;
+            std::uint64_t  kind;
+            bool           stored;
+        };
+
+
+
+        static constexpr unsigned  N  =  sizeof...(Key);
+
+
+        static constexpr field_  fields_[ N + 1 ]  =
+        {
+            field_{  name_< Key >::value
+                  ,  sizeof( Value )
+                  ,  alignof( Value )
+                  ,  kind_< Value >()
+                  ,  type_hull<  Entry_t< Key, Value >  >{}  ==  type_hull<  entry_t< Key, Value >  >{}
+                  }...
+        ,   field_{  "",  0,  1,  0,  false  }
+        };
+
+
+
+        struct plan_
+        {
+            std::size_t    offset[ N + 1 ];
+            std::size_t    size;
+            std::size_t    alignment;
+            std::uint64_t  hash;
+        };
+
+
+
+        static consteval bool less_(  char const* x,  char const* y  )
+        {
+            for ( ;  *x != '\0'  &&  *x == *y;  ++x, ++y )
+                ;
+
+            return  static_cast< unsigned char >( *x )  <  static_cast< unsigned char >( *y );
+        }
+
+
+
+        static consteval std::uint64_t mix_(  std::uint64_t h,  std::uint64_t x  )  // FNV-1a, byte by byte
+        {
+            for ( unsigned k = 0;  k != 8;  ++k,  x >>= 8 )
+                h = ( h ^ ( x & 0xff ) ) * 0x100000001b3ull;
+
+            return h;
+        }
+
+
+
+        static consteval plan_ make_plan_()
+        {
+            plan_     plan{};
+            unsigned  order[ N + 1 ] = {};
+
+            for ( unsigned i = 0;  i != N;  ++i )
+            {
+                unsigned j = i;
+
+                for ( ;  j != 0  &&  less_(  fields_[ i ].name,  fields_[ order[j-1] ].name  );  --j )
+                    order[ j ] = order[ j-1 ];
+
+                order[ j ] = i;
+            }
+
+
+            std::size_t    position   =  0;
+            std::size_t    alignment  =  1;
+            std::uint64_t  hash       =  0xcbf29ce484222325ull;
+
+            for ( unsigned j = 0;  j != N;  ++j )
+            {
+                field_ const& f = fields_[ order[j] ];
+
+                if ( ! f.stored )
+                    continue;
+
+                position  =  ( position + f.alignment - 1 ) / f.alignment * f.alignment;
+                alignment =  f.alignment > alignment  ?  f.alignment  :  alignment;
+
+                plan.offset[ order[j] ] = position;
+
+                for ( char const* c = f.name;  *c != '\0';  ++c )
+                    hash = mix_( hash,  static_cast< unsigned char >( *c ) );
+
+                hash = mix_(  mix_(  mix_(  mix_( hash,  f.size ),  f.alignment  ),  f.kind  ),  position  );
+
+                position += f.size;
+            }
+
+            plan.size       =  ( position + alignment - 1 ) / alignment * alignment;
+            plan.alignment  =  alignment;
+            plan.hash       =  mix_( hash,  plan.size );
+
+            return plan;
+        }
+
+
+
+        static constexpr plan_  plan_value_  =  make_plan_();
+
+
+
+        template<  typename K  >
+        static consteval unsigned index_()
+        {
+            bool const match[] = {  type_hull< K >{} == type_hull< Key >{}...,  false  };
+
+            unsigned i = 0;
+
+            while ( i != N  &&  ! match[ i ] )
+                ++i;
+
+            return i;
+        }
+
+
+
+        template<  typename K  >
+        using entry_  =  typename map<  pair<  Key,  Entry_t< Key, Value >  >...  >::template lookup< K >;
+
+
+
+    public:
+
+        static constexpr std::size_t    size       =  plan_value_.size;
+        static constexpr std::size_t    alignment  =  plan_value_.alignment;
+        static constexpr std::uint64_t  hash       =  plan_value_.hash;
+
+
+
+        template<  typename K  >
+        requires (  index_< K >() != N  )
+        static constexpr bool stored(  type_hull< K >  )  noexcept
+        {
+            return fields_[ index_< K >() ].stored;
+        }
+
+
+
+        template<  typename K  >
+        requires (  index_< K >() != N  )
+        static constexpr std::size_t offset(  type_hull< K >  )  noexcept
+        {
+            return plan_value_.offset[ index_< K >() ];
+        }
+
+
+
+        template<  typename K  >
+        requires (  index_< K >() != N  )
+        static auto load(  type_hull< K >  k,  std::byte const*  data  )  noexcept
+        {
+            using entry  =  entry_< K >;
+
+            if constexpr (  stored(  type_hull< K >{}  )  )
+            {
+                typename entry::value  v;
+                std::memcpy(  &v,  data + offset( k ),  sizeof( v )  );
+                return v;
+            }
+            else
+            {
+                return record< entry >{}[ k ];
+            }
+        }
+
+
+
+        template<  typename K  >
+        requires (  index_< K >() != N  )
+        static void store(  type_hull< K >  k,  record<  Entry_t< Key, Value >...  > const&  r,  std::byte*  data  )  noexcept
+        {
+            if constexpr (  stored(  type_hull< K >{}  )  )
+                std::memcpy(  data + offset( k ),  &r[ k ],  sizeof( r[ k ] )  );
+        }
+
+
+
+        static void store(  record<  Entry_t< Key, Value >...  > const&  r,  std::byte*  data  )  noexcept
+        {
+            std::memset(  data,  0,  size  );
+
+            (  store(  type_hull< Key >{},  r,  data  ),  ...  );
+        }
+    };
+
+
+
+    template<  typename Record  >
+    std::size_t write_to(  Record const&  r,  std::span< std::byte >  buffer  )  noexcept
+    {
+        if ( buffer.size() < binary_layout< Record >::size )
+            return 0;
+
+        binary_layout< Record >::store(  r,  buffer.data()  );
+
+        return binary_layout< Record >::size;
+    }
+
+
+
+    template<  typename Record  >
+    struct record_view;
+
+
+
+    template<  typename...                        Key
+            ,  typename...                        Value
+            ,  template<  typename... > class...  Entry_t
+            >
+    struct record_view<  record<  Entry_t< Key, Value >...  >  >
+    {
+    private:
+
+        std::byte const*  data_;
+
+
+
+        template<  typename K  >
+        void load_into_(  type_hull< K >  k,  record<  Entry_t< Key, Value >...  >&  r  )  const  noexcept
+        {
+            if constexpr (  binary_layout<  record<  Entry_t< Key, Value >...  >  >::stored(  type_hull< K >{}  )  )
+                r[ k ] = (*this)[ k ];
+        }
+
+
+    public:
+
+        using layout  =  binary_layout<  record<  Entry_t< Key, Value >...  >  >;
+
+
+
+        explicit record_view(  std::span< std::byte const >  buffer  )  noexcept
+        :   data_(  buffer.data()  )
+        {
+            assert(  buffer.size() >= layout::size  );
+        }
+
+
+
+        template<  typename K  >
+        auto operator[](  type_hull< K >  k  )  const  noexcept
+        ->  decltype(  layout::load(  k,  data_  )  )
+        {
+            return layout::load(  k,  data_  );
+        }
+
+
+
+        decltype(auto) invoke(  auto&& f  )  const
+        {
+            return f(  (*this)[ type_hull< Key >{} ]...  );
+        }
+
+
+
+        operator record<  Entry_t< Key, Value >...  >()  const
+        {
+            record<  Entry_t< Key, Value >...  >  r;
+
+            (  load_into_(  type_hull< Key >{},  r  ),  ...  );
+
+            return r;
+        }
+    };
+}
@@ -0,0 +1,217 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "lt/record_columns.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+
+
+namespace lt
+{
+//  Loading delimited text (CSV, TSV) into record_columns:
+//
+//  record_loader< record_columns< Entries... > > maps the fields of a header line to
+//  the entries once, by comparing the header names with the key texts of the entries.
+//  Afterwards every line is split at the delimiter and each field is parsed directly
+//  into the value of its entry; fields without an entry are skipped, entries without
+//  a field keep their default value.  Arithmetic values are parsed with from_chars,
+//  bool accepts 0/1/false/true and other values are constructed from a string_view.
+//
+//  load( chunk, columns ) consumes all complete lines of chunk and returns the number
+//  of consumed characters, so that the caller can carry the incomplete last line over
+//  to the next chunk.  With last = true the final line needs no line break.
+//  Quoted fields are not supported.
+
+    template<  typename Columns  >
+    struct record_loader;
+
+
+
+    template<  typename...                        Key
+            ,  typename...                        Value
+            ,  template<  typename... > class...  Entry_t
+            >
+    requires
+        without_packed_entries<  Entry_t< Key, Value >...  >
+    struct record_loader<  record_columns<  Entry_t< Key, Value >...  >  >
+    {
+    private:
+
+        using record_t   =  record<  Entry_t< Key, Value >...  >;
+        using columns_t  =  record_columns<  Entry_t< Key, Value >...  >;
+
+
+
+        template<  typename K  >
+        struct name_;
+
+
+
+        template<  char... c  >
+        struct name_<  text< c... >  >
+        {
+            static constexpr char value[] = {  c...,  '\0'  };
+        };
+
+
+
+        template<  typename V  >
+        static bool parse_(  std::string_view  field,  V&  v  )
+        {
+            if constexpr (  std::is_same_v< V, bool >  )
+            {
+                v = field == "1"  ||  field == "true";
+                return v  ||  field == "0"  ||  field == "false";
+            }
+            else if constexpr (  std::is_arithmetic_v< V >  )
+            {
+                auto const [ end, error ] = std::from_chars(  field.data(),  field.data() + field.size(),  v  );
+                return  error == std::errc{}  &&  end == field.data() + field.size();
+            }
+            else
+            {
+                v = V(  field  );
+                return true;
+            }
+        }
+
+
+
+        template<  typename K,  typename V  >
+        static bool set_(  record_t&  r,  std::string_view  field  )
+        {
+            return parse_(  field,  r[ type_hull< K >{} ]  );
+        }
+
+
+
+        using setter_  =  bool (*)(  record_t&,  std::string_view  );
+
+
+
+        template<  typename K,  typename V  >
+        static constexpr setter_  setter_of_(  type_hull<  entry_t< K, V >  >  )  noexcept {  return &set_< K, V >;  }
+
+
+        template<  typename K,  typename V  >
+        static constexpr setter_  setter_of_(  type_hull<  fixed_entry_t< K, V >  >  )  noexcept {  return nullptr;  }
+
+
+
+        static constexpr std::string_view  names_[]    =  {  name_< Key >::value...,  ""  };
+
+        static constexpr setter_           setters_[]  =  {  setter_of_(  type_hull<  Entry_t< Key, Value >  >{}  )...,  nullptr  };
+
+
+
+        static std::string_view  next_field_(  std::string_view&  line,  char  delimiter  )  noexcept
+        {
+            auto const  end    =  line.find( delimiter );
+            auto const  field  =  line.substr(  0,  end  );
+
+            line.remove_prefix(  end == std::string_view::npos  ?  line.size()  :  end + 1  );
+
+            return field;
+        }
+
+
+
+        char                    delimiter_;
+        std::vector< setter_ >  field_setters_;
+        std::size_t             rows_    =  0;
+        std::size_t             errors_  =  0;
+
+
+
+    public:
+
+        explicit record_loader(  char delimiter = ','  )
+        :   delimiter_( delimiter )
+        { }
+
+
+
+        void read_header(  std::string_view  line  )
+        {
+            if ( ! line.empty()  &&  line.back() == '\r' )
+                line.remove_suffix( 1 );
+
+            field_setters_.clear();
+
+            for ( bool more = true;  more;  )
+            {
+                more = line.find( delimiter_ ) != std::string_view::npos;
+
+                auto const name = next_field_(  line,  delimiter_  );
+
+                setter_ s = nullptr;
+
+                for ( std::size_t k = 0;  k != sizeof...(Key);  ++k )
+                    if ( names_[ k ] == name )
+                        s = setters_[ k ];
+
+                field_setters_.push_back( s );
+            }
+        }
+
+
+
+        void load_line(  std::string_view  line,  columns_t&  columns  )
+        {
+            if ( ! line.empty()  &&  line.back() == '\r' )
+                line.remove_suffix( 1 );
+
+            record_t r;
+
+            for ( setter_ s : field_setters_ )
+            {
+                auto const field = next_field_(  line,  delimiter_  );
+
+                if ( s != nullptr  &&  ! s(  r,  field  ) )
+                    ++errors_;
+            }
+
+            columns.push_back(  r.move()  );
+            ++rows_;
+        }
+
+
+
+        std::size_t load(  std::string_view  chunk,  columns_t&  columns,  bool  last = false  )
+        {
+            std::size_t consumed = 0;
+
+            for ( auto end = chunk.find( '\n' );  end != std::string_view::npos;  end = chunk.find( '\n',  consumed )  )
+            {
+                load_line(  chunk.substr(  consumed,  end - consumed  ),  columns  );
+                consumed = end + 1;
+            }
+
+            if ( last  &&  consumed != chunk.size() )
+            {
+                load_line(  chunk.substr( consumed ),  columns  );
+                consumed = chunk.size();
+            }
+
+            return consumed;
+        }
+
+
+
+        std::size_t rows()    const noexcept {  return rows_;    }
+        std::size_t errors()  const noexcept {  return errors_;  }
+    };
+}
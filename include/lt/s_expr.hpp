@@ -10,490 +10,7 @@
 #pragma once
 
 
-#include "type_hull.hpp"
-#include "text.hpp"
-#include "map.hpp"
-
-namespace lt
-{
-// PART 0: Types
-
-
-// values:
-
-    template<  auto const x >
-    struct v
-    {
-        using type = decltype(x);
-    };
-
-
-    template< auto const x  >
-    using value = v< x >;
-
-
-
-    template<  int const n  >
-    using integer  =  value< n >;
-
-
-
-    // value_type removes const qualifiers:
-    // value_type<x> is T for an object of type "T const"
-    template<  auto const x  >
-    using value_type = typename value<x>::type;
-
-
-
-// s: a type for brackets ( ... ) in symbolic expressions
-
-
-
-    template<  typename...  >
-    struct s { };
-
-
-
-// quoted expression:
-
-    template<  typename  >
-    struct quoted {};
-
-
-
-// marker for lists with n elements:
-
-    template< unsigned n >
-    requires
-    (
-        n > 0
-    )
-    struct list{};
-
-
-    template<  unsigned n
-            ,  typename... xs  >
-    struct s<  list<n>,  xs...  >
-    {
-        static_assert(  n == sizeof...(xs)
-                     ,  "An expression of the form  's<  list<n>,  xs... >'  "
-                        "must satisfy n == sizeof...(xs)!"  );
-    };
-
-
-//  literal_or_s
-
-
-    template<  unsigned,  typename  >
-    struct literal_or_s;
-
-
-
-    template<  unsigned N
-            ,  typename
-            >
-    struct literal_or_s
-    :   public text<>::literal< N >
-    {
-        consteval literal_or_s( char const (& content)[N] )
-        :   lt::text<>::literal<N>(content)
-        { };
-
-
-
-        consteval literal_or_s( text<>::literal<N> const& other )
-        :   lt::text<>::literal<N>(other)
-        { }
-
-
-        using type = text<>::literal< N >;
-    };
-
-
-
-    template<  typename S_Expr >
-    struct literal_or_s< 0,  S_Expr const >
-    {
-        consteval literal_or_s(  S_Expr const )  { }
-
-        using type = S_Expr;
-    };
-
-
-
-    template<  typename T  >
-    literal_or_s(T const t) -> literal_or_s<  0,  T const  >;
-
-
-
-    template<  unsigned N  >
-    literal_or_s( char const (&)[N] ) -> literal_or_s< N,  char const (&)[N]  >;
-
-
-
-    template<  unsigned N  >
-    literal_or_s( text<>::literal<N> const& )   ->  literal_or_s< N,  char const (&)[N]  >;
-
-
-
-// nil:
-
-    template< >
-    struct s<>
-    {
-    private:
-
-        struct parser;
-
-
-
-        template<  typename T
-                ,  typename
-                >
-        struct subst_
-        :   type_hull< T >
-        { };
-
-
-
-        template<  char...                         id
-                ,  typename                        Subst
-                >
-        struct subst_<  text< id... >,  Subst  >
-        :   type_hull<  typename Subst::template lookup<  text< id... >,  text< id...  >  >  >
-        { };
-
-
-
-        template<  typename...                      Xs
-                ,  typename                         Subst
-                >
-        requires(  sizeof...(Xs) != 0  )
-        struct subst_<  s< Xs... >,  Subst  >
-        :   type_hull<  s<  typename subst_<  Xs,  Subst  >::type...  >  >
-        { };
-
-
-
-        template<  literal_or_s  src
-                ,  map           subst
-                ,  typename         =  decltype(src)
-                ,  typename      s_ = s<>
-                >
-        struct expr_;
-
-
-
-        template<  literal_or_s  src
-                ,  map           subst
-                ,  typename      Src
-                ,  typename      s_
-                >
-        requires
-        requires(  decltype(src.content)  )
-        {
-            nullptr;
-        }
-        struct expr_<  src,  subst,  Src,  s_  >
-        :   s_::parser::template run< static_cast< text<>::literal< sizeof(src.content) > const&>(src),  subst  >
-        { };
-
-
-
-        template<  literal_or_s  src
-                ,  map           subst
-                ,  typename      T
-                ,  typename      s_
-                >
-        struct expr_<  src,  subst,  literal_or_s<  0,   T const  >, s_  >
-        :   subst_<  value_type< T{} >,  decltype(subst)  >
-        { };
-
-
-
-    public:
-
-        template<  literal_or_s  src
-                ,  map           subst
-                >
-        using expr =  typename expr_< src, subst >::type;
-    };
-
-
-
-    using nil = s<>;
-
-
-
-    template<  literal_or_s const  src
-            ,  map const           subst = map{}
-            >
-    using s_expr  =  typename s<>::template expr< src, subst>;
-
-
-
-    template< lt::text<>::literal expr  >
-    constexpr s_expr<expr> operator""_s_expr()  noexcept
-    {
-        return {};
-    }
-
-
-// PART I:  Symbolic Components
-
-
-// -----------------------------------------------------------------------------
-// class_template:
-// -----------------------------------------------------------------------------
-
-
-    template<  template< typename... >  class  >
-    struct ct {};
-
-
-
-    template<  template< typename... >  class F  >
-    using class_template  =  ct< F >;
-
-
-
-// -----------------------------------------------------------------------------
-// combinator:
-// -----------------------------------------------------------------------------
-
-    template<  unsigned n,  template< typename... >  class,  typename...  >
-    struct co {};
-
-
-
-    template<  unsigned                       n
-            ,  template< typename... > class  F
-            ,  typename...                    Prefix
-            >
-    using combinator  =  co<  n,  F,  Prefix...  >;
-
-
-
-// -----------------------------------------------------------------------------
-// Assign a type to a symbol:
-// -----------------------------------------------------------------------------
-
-
-    template<  typename K,  typename V  >
-    struct pair
-    {
-        using key    =  K;
-        using value  =  V;
-    };
-
-
-    template<  lt::text<>::literal symbol,  typename T  >
-    inline constexpr auto let = pair<  decltype(operator""_text<symbol>()),  T  >{};
-
-
-
-// PART II:  Lambda-Calculus
-
-
-    struct S {};  //  S represents the S-combinator  S = lambda xyz . xz(yz).
-    struct K {};  //  K represents the K-combinator  K = lambda xy.x.
-
-
-
-    template<  typename...  >
-    struct application;
-
-
-
-    template<>
-    struct application<>
-    {
-    private:
-
-        template<  typename...  >
-        friend struct application;
-
-
-        template<  typename X  >
-        using with_result  =  type_hull<X>;
-
-
-// Make opposite expression:
-
-        template<  typename... no_elements >
-        struct r_expr
-        {
-            static_assert( sizeof...(no_elements) == 0 );
-
-
-            using reverse = r_expr<>;
-
-
-            template<  typename X  >
-            using rcons = r_expr< X >;
-        };
-
-
-
-        template<  typename H,  typename... T  >
-        struct r_expr< H, T... >
-        {
-            using reverse =   typename r_expr< T... >::reverse::template rcons< H >;
-
-
-            template<  typename X  >
-            using rcons  = r_expr<  H,  T...,  X  >;
-        };
-
-
-
-        template<  typename X  >
-        struct opposite_expr
-        :   with_result<  X  >
-        { };
-
-
-
-        template<  typename     X
-                ,  typename...  Xs
-                >
-        struct opposite_expr<  s<  X,  Xs... >  >
-        :   with_result<  typename r_expr<  typename opposite_expr< X  >::type
-                                         ,  typename opposite_expr< Xs >::type...  >::
-                          reverse
-                       >
-        {
-            static_assert(sizeof...(Xs) != 0
-                         , "Forbidden nullary function call. No user-defined function f "
-                           "may be called without arguments via the expression (f)." );
-        };
-
-
-//  Apply variable to opposite expression
-
-
-        template<  typename,  typename   >
-        struct ap_;
-
-
-
-        template<  char... x  >
-        struct ap_<  text< x... >,  text< x... >  >
-        :   with_result<  s< S, K, K >  >
-        { };
-
-
-
-        template<  char...   x
-                ,  typename  Y
-                >
-        struct ap_< text<x...>,  Y  >
-        :   with_result<  s< K, Y  >  >
-        { };
-
-
-
-        template<  typename,  typename  >
-        struct combine_;
-
-
-
-        template<  char...   x
-                ,  typename  Q
-                ,  typename  P
-                >
-        struct ap_<  text<x...>,  r_expr<  Q,  P  >  >
-        :   combine_<  typename  ap_< text<x...>, P >::type
-                    ,  typename  ap_< text<x...>, Q >::type
-                    >
-        { };
-
-
-
-        template<  char...      x
-                ,  typename     Q
-                ,  typename     P
-                ,  typename...  Ps
-                >
-        struct ap_<  text<x...>,  r_expr<  Q,  P,  Ps...  >  >
-        :   combine_<  typename  ap_<  text<x...>,  r_expr<  P,  Ps... >  >::type
-                    ,  typename  ap_<  text<x...>,  Q  >::type
-                    >
-        { };
-
-
-
-        template<  typename P,  typename Q  >
-        struct combine_
-        :   with_result<  s< S,  P,  Q  >  >
-        { };
-
-
-
-
-        template<  typename P,  typename Q  >
-        struct combine_<  s< K, P >,  s< K, Q >  >
-        :   with_result<  s<  K,  s< P, Q >  >  >
-        { };
-
-
-
-        template<  typename     P
-                ,  typename...  Ps
-                ,  typename     Q
-                >
-        struct combine_<  s< K, s< P,  Ps... > >,  s< K, Q >  >
-        :   with_result<  s<  K,  s< P, Ps...,  Q >  >  >
-        { };
-
-
-
-        template<  typename     P  >
-        struct combine_<  s<  K,  P  >,  s< S, K, K >  >
-        :   with_result< P >
-        { };
-    };
-
-
-
-    template<  char...  X  >
-    struct application<  text< X... >  >
-    {
-        template<  typename Expr  >
-        using apply_to  =
-        typename application<>::
-        template ap_<  text< X... >
-
-                    ,  typename application<>::
-                       template opposite_expr<  Expr  >::
-                       type
-
-                    >::type;
-    };
-
-
-
-    template<  typename      X
-            ,  typename      Y
-            ,  typename...   Ys
-            >
-    requires
-    (
-        text_type<X>  &&
-        ( text_type<Y>  &&  ...  &&  text_type<Ys> )
-    )
-    struct application<  X,  Y,  Ys...  >
-    {
-        template<  typename  Expr  >
-        using apply_to  =
-        typename application<  X  >::
-        template apply_to<  typename application<  Y,  Ys...  >::
-                            template apply_to<  Expr  >
-                         >;
-    };
-
-
-}
+#include "s_types.hpp"
 
 
 
@@ -582,6 +99,20 @@ struct lt::s<>::parser
             case '}':
                 return token{ pos_,  pos_+1 };
 
+            case '#':
+                if ( src[pos_+1] == '(' )       // packed list literal:  #( ... ) is a single token
+                {
+                    unsigned pos_end_ = pos_ + 2;
+
+                    while(  src[pos_end_] != '\0'  &&  src[pos_end_] != ')'  )
+                    {
+                        ++pos_end_;
+                    }
+
+                    return token{ pos_,  src[pos_end_] == ')' ?  pos_end_ + 1  :  pos_end_ };
+                }
+                break;
+
             default:
                 ;
             }
@@ -611,8 +142,15 @@ struct lt::s<>::parser
 
 
 
+        template<  typename T  >       // integer literals with a suffix,  see below
+        struct suffixed_sublexer_
+        :   sublexer_< T >
+        { };
+
+
+
         template<  typename T  >
-        using sublexer  =  typename sublexer_<T>::type;
+        using sublexer  =  typename suffixed_sublexer_<T>::type;
 
 
 
@@ -665,6 +203,14 @@ struct lt::s<>::parser
         // oct_suffix := [0-7]*
         // bin_suffix := [0,1]+
 
+        // A num is an int.  A num followed by one of the type suffixes
+        //
+        //      u | U          unsigned
+        //      ll | LL        long long
+        //      ull | ULL      unsigned long long
+        //
+        // is a value of that type (unsigned literals have no minus sign).
+
 
 
         template< char d  >
@@ -831,6 +377,313 @@ struct lt::s<>::parser
         :   construct_number<  10,  digit<10, h>(),  digit<10, t>()...  >
         { };
 
+
+
+// sublexer for integer literals with a type suffix:
+//
+// The number is read in a constant expression as unsigned long long.  Literals
+// out of the range of their type call the non-constexpr integer_literal_error_.
+
+        enum suffix_t {  no_suffix,  u_suffix,  ll_suffix,  ull_suffix  };
+
+
+
+        struct integer_literal_
+        {
+            suffix_t            suffix  =  no_suffix;
+            bool                minus   =  false;
+            unsigned long long  x       =  0;
+        };
+
+
+
+        static void integer_literal_error_(  char const*  )  { }
+
+
+
+        //  the suffix of src,  if src is a number with a suffix:
+
+        static consteval suffix_t integer_suffix_of_(  char const*  src  )
+        {
+            unsigned k = 0;
+
+            if ( src[k] == '+'  ||  src[k] == '-' )
+                ++k;
+
+            if ( src[k] < '0'  ||  src[k] > '9' )
+                return no_suffix;
+
+            unsigned n = k;
+
+            while ( src[n] != '\0' )
+            {
+                ++n;
+            }
+
+            bool const  u   =  src[n-1] == 'u'  ||  src[n-1] == 'U';
+            bool const  ll  =  n - k >= 3  &&  (  src[n-1] | 0x20  ) == 'l'  &&  (  src[n-2] | 0x20  ) == 'l';
+
+            if ( ll  &&  n - k >= 4  &&  (  src[n-3] | 0x20  ) == 'u' )
+                return ull_suffix;
+
+            if ( ll )
+                return ll_suffix;
+
+            if ( u  &&  n - k >= 2 )
+                return u_suffix;
+
+            return no_suffix;
+        }
+
+
+
+        static consteval integer_literal_ integer_literal_of_(  char const*  src  )
+        {
+            integer_literal_  r;
+
+            unsigned k = 0;
+
+            r.suffix  =  integer_suffix_of_( src );
+            r.minus   =  src[k] == '-';
+
+            if ( src[k] == '-'  ||  src[k] == '+' )
+                ++k;
+
+            int       base    =  10;
+            unsigned  digits  =  0;
+
+            if ( src[k] == '0' )
+            {
+                ++k;
+                ++digits;
+                base = 8;
+
+                if ( src[k] == 'x'  ||  src[k] == 'X' )
+                    base = 16;
+                else if ( src[k] == 'b'  ||  src[k] == 'B' )
+                    base = 2;
+
+                if ( base != 8 )
+                {
+                    ++k;
+                    digits = 0;
+                }
+            }
+
+            for ( ;  src[k] != 'u'  &&  src[k] != 'U'  &&  src[k] != 'l'  &&  src[k] != 'L';  ++k,  ++digits )
+            {
+                char const  c  =  src[k];
+
+                int const  d  =  '0' <= c  &&  c <= '9'  ?  c - '0'
+                              :  'a' <= c  &&  c <= 'f'  ?  c - 'a' + 10
+                              :  'A' <= c  &&  c <= 'F'  ?  c - 'A' + 10
+                              :  base;
+
+                if ( d >= base )
+                    integer_literal_error_( "integer literal:  invalid digit" );
+
+                if ( r.x > ( ~0ull - d ) / base )
+                    integer_literal_error_( "integer literal:  number out of range of unsigned long long" );
+
+                r.x = r.x * base + d;
+            }
+
+            if ( digits == 0 )
+                integer_literal_error_( "integer literal:  number expected" );
+
+            if ( src[ k + r.suffix ] != '\0' )             // the length of the suffix is r.suffix
+                integer_literal_error_( "integer literal:  invalid suffix" );
+
+            if ( r.minus  &&  r.suffix != ll_suffix )
+                integer_literal_error_( "integer literal:  unsigned number with minus sign" );
+
+            if ( r.suffix == u_suffix  &&  r.x > 0xffffffffull )
+                integer_literal_error_( "integer literal:  number out of range of unsigned" );
+
+            if ( r.suffix == ll_suffix  &&  r.x > 0x7fffffffffffffffull + r.minus )
+                integer_literal_error_( "integer literal:  number out of range of long long" );
+
+            return r;
+        }
+
+
+
+        template<  char... c  >
+        static consteval integer_literal_ read_integer_()
+        {
+            char const  src[]  =  {  c...,  '\0'  };
+
+            return integer_literal_of_( src );
+        }
+
+
+
+        template<  char... c  >
+        static consteval suffix_t integer_suffix_()
+        {
+            char const  src[]  =  {  c...,  '\0'  };
+
+            return integer_suffix_of_( src );
+        }
+
+
+
+        template<  char... c  >
+        static consteval auto suffixed_integer_()
+        {
+            constexpr integer_literal_  r  =  read_integer_< c... >();
+
+            if constexpr ( r.suffix == u_suffix )
+                return static_cast< unsigned >( r.x );
+            else if constexpr ( r.suffix == ll_suffix )
+                return static_cast< long long >(  r.minus  ?  0ull - r.x  :  r.x  );
+            else
+                return r.x;
+        }
+
+
+
+        template<  char... c  >
+        requires(  integer_suffix_< c... >() != no_suffix  )
+        struct suffixed_sublexer_<  text< c... >  >
+        :   type_hull<  value<  suffixed_integer_< c... >()  >  >
+        { };
+
+
+
+// sublexer for packed lists #( num ... ):
+//
+// The numbers follow the grammar above.  They are read by packed_literal_ in a constant
+// expression, so that the cost of a literal does not grow with the number of types
+// instantiated per element.  packed_literal_ stores the numbers in out (unless out is
+// nullptr) and returns their count;  it calls the non-constexpr packed_literal_error_
+// if the literal is ill-formed,  which makes the compiler report the reason.
+
+        static void packed_literal_error_(  char const*  )  { }
+
+
+
+        static consteval unsigned packed_literal_(  char const*  src,  int*  out  )
+        {
+            unsigned n = 0;
+            unsigned k = 0;
+
+            for ( ;; )
+            {
+                while ( is_whitespace( src[k] ) )
+                {
+                    ++k;
+                }
+
+                if ( src[k] == '\0' )
+                    packed_literal_error_( "#( ... ):  missing closing bracket" );
+
+                if ( src[k] == ')' )
+                {
+                    if ( src[k+1] != '\0' )
+                        packed_literal_error_( "#( ... ):  unexpected characters after closing bracket" );
+
+                    return n;
+                }
+
+
+                bool const  minus  =  src[k] == '-';
+
+                if ( src[k] == '-'  ||  src[k] == '+' )
+                    ++k;
+
+                int       base    =  10;
+                unsigned  digits  =  0;
+
+                if ( src[k] == '0' )
+                {
+                    ++k;
+                    ++digits;
+                    base = 8;
+
+                    if ( src[k] == 'x'  ||  src[k] == 'X' )
+                        base = 16;
+                    else if ( src[k] == 'b'  ||  src[k] == 'B' )
+                        base = 2;
+
+                    if ( base != 8 )
+                    {
+                        ++k;
+                        digits = 0;
+                    }
+                }
+
+                long long x = 0;
+
+                for ( ;  src[k] != '\0'  &&  src[k] != ')'  &&  ! is_whitespace( src[k] );  ++k,  ++digits )
+                {
+                    char const  c  =  src[k];
+
+                    int const  d  =  '0' <= c  &&  c <= '9'  ?  c - '0'
+                                  :  'a' <= c  &&  c <= 'f'  ?  c - 'a' + 10
+                                  :  'A' <= c  &&  c <= 'F'  ?  c - 'A' + 10
+                                  :  base;
+
+                    if ( d >= base )
+                        packed_literal_error_( "#( ... ):  invalid digit" );
+
+                    x = x * base + d;
+
+                    if ( x > 0x80000000ll )
+                        packed_literal_error_( "#( ... ):  number out of range of int" );
+                }
+
+                if ( digits == 0 )
+                    packed_literal_error_( "#( ... ):  number expected" );
+
+                if ( ! minus  &&  x == 0x80000000ll )
+                    packed_literal_error_( "#( ... ):  number out of range of int" );
+
+                if ( out != nullptr )
+                    out[n] = static_cast< int >(  minus ?  -x  :  x  );
+
+                ++n;
+            }
+        }
+
+
+
+        template<  char... c  >
+        static consteval unsigned packed_count_()
+        {
+            char const  src[]  =  {  c...,  '\0'  };
+
+            return packed_literal_(  src,  nullptr  );
+        }
+
+
+
+        template<  char... c  >
+        static consteval std::array<  int,  packed_count_< c... >()  >  packed_values_()
+        {
+            char const  src[]  =  {  c...,  '\0'  };
+
+            std::array<  int,  packed_count_< c... >()  >  xs{};
+            packed_literal_(  src,  xs.data()  );
+
+            return xs;
+        }
+
+
+
+        template<  char... c  >
+        struct sublexer_<  text< '#', '(', c... >  >
+        :   type_hull<  value<  packed_values_< c... >()  >  >
+        { };
+
+
+
+        template<  char... c  >
+        requires(  packed_count_< c... >() == 0  )
+        struct sublexer_<  text< '#', '(', c... >  >
+        :   type_hull<  s<>  >
+        { };
+
     };
 
 
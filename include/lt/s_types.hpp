@@ -0,0 +1,538 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//  The types of the symbolic expressions:  values,  lists,  texts and combinators.
+//  The parser of s_expr lives in s_expr.hpp;  headers that only name types
+//  (type_system.hpp,  record.hpp,  dispatch.hpp) include this file and do not pay
+//  for parsing the lexer and the grammar in every translation unit.
+
+
+#pragma once
+
+
+#include "type_hull.hpp"
+#include "text.hpp"
+#include "map.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace lt
+{
+// PART 0: Types
+
+
+// values:
+
+    template<  auto const x >
+    struct v
+    {
+        using type = decltype(x);
+    };
+
+
+    template< auto const x  >
+    using value = v< x >;
+
+
+
+    template<  int const n  >
+    using integer  =  value< n >;
+
+
+
+    // value_type removes const qualifiers:
+    // value_type<x> is T for an object of type "T const"
+    template<  auto const x  >
+    using value_type = typename value<x>::type;
+
+
+
+// packed integer lists:
+//
+// value< std::array< int, n >{ x1, ..., xn } > with n != 0 is the list ( x1 ... xn ) of
+// integers in a single template argument.  first, drop_first, count, cons, rcons, eq and
+// fold of the interpreter work on it directly, without instantiating a type per element;
+// the empty list is always s<>.  ( pack xs ) and ( unpack xs ) convert from and to
+// s< integer<x1>, ..., integer<xn> >, and #( x1 ... xn ) is a packed list literal.
+
+    template<  int... x  >
+    using packed  =  value<  std::array<  int,  sizeof...(x)  >{  x...  }  >;
+
+
+
+    template<  typename  >
+    struct packed_list_
+    {
+        static constexpr bool value  =  false;
+    };
+
+
+    template<  std::size_t n,  std::array< int, n > xs  >
+    struct packed_list_<  value< xs >  >
+    {
+        static constexpr bool value  =  n != 0;
+    };
+
+
+
+    template<  typename X  >
+    concept packed_list  =  packed_list_< X >::value;
+
+
+
+// s: a type for brackets ( ... ) in symbolic expressions
+
+
+
+    template<  typename...  >
+    struct s { };
+
+
+
+// quoted expression:
+
+    template<  typename  >
+    struct quoted {};
+
+
+
+// marker for lists with n elements:
+
+    template< unsigned n >
+    requires
+    (
+        n > 0
+    )
+    struct list{};
+
+
+    template<  unsigned n
+            ,  typename... xs  >
+    struct s<  list<n>,  xs...  >
+    {
+        static_assert(  n == sizeof...(xs)
+                     ,  "An expression of the form  's<  list<n>,  xs... >'  "
+                        "must satisfy n == sizeof...(xs)!"  );
+    };
+
+
+//  literal_or_s
+
+
+    template<  unsigned,  typename  >
+    struct literal_or_s;
+
+
+
+    template<  unsigned N
+            ,  typename
+            >
+    struct literal_or_s
+    :   public text<>::literal< N >
+    {
+        consteval literal_or_s( char const (& content)[N] )
+        :   lt::text<>::literal<N>(content)
+        { };
+
+
+
+        consteval literal_or_s( text<>::literal<N> const& other )
+        :   lt::text<>::literal<N>(other)
+        { }
+
+
+        using type = text<>::literal< N >;
+    };
+
+
+
+    template<  typename S_Expr >
+    struct literal_or_s< 0,  S_Expr const >
+    {
+        consteval literal_or_s(  S_Expr const )  { }
+
+        using type = S_Expr;
+    };
+
+
+
+    template<  typename T  >
+    literal_or_s(T const t) -> literal_or_s<  0,  T const  >;
+
+
+
+    template<  unsigned N  >
+    literal_or_s( char const (&)[N] ) -> literal_or_s< N,  char const (&)[N]  >;
+
+
+
+    template<  unsigned N  >
+    literal_or_s( text<>::literal<N> const& )   ->  literal_or_s< N,  char const (&)[N]  >;
+
+
+
+// nil:
+
+    template< >
+    struct s<>
+    {
+    private:
+
+        struct parser;
+
+
+
+        template<  typename T
+                ,  typename
+                >
+        struct subst_
+        :   type_hull< T >
+        { };
+
+
+
+        template<  char...                         id
+                ,  typename                        Subst
+                >
+        struct subst_<  text< id... >,  Subst  >
+        :   type_hull<  typename Subst::template lookup<  text< id... >,  text< id...  >  >  >
+        { };
+
+
+
+        template<  typename...                      Xs
+                ,  typename                         Subst
+                >
+        requires(  sizeof...(Xs) != 0  )
+        struct subst_<  s< Xs... >,  Subst  >
+        :   type_hull<  s<  typename subst_<  Xs,  Subst  >::type...  >  >
+        { };
+
+
+
+        template<  literal_or_s  src
+                ,  map           subst
+                ,  typename         =  decltype(src)
+                ,  typename      s_ = s<>
+                >
+        struct expr_;
+
+
+
+        template<  literal_or_s  src
+                ,  map           subst
+                ,  typename      Src
+                ,  typename      s_
+                >
+        requires
+        requires(  decltype(src.content)  )
+        {
+            nullptr;
+        }
+        struct expr_<  src,  subst,  Src,  s_  >
+        :   s_::parser::template run< static_cast< text<>::literal< sizeof(src.content) > const&>(src),  subst  >
+        { };
+
+
+
+        template<  literal_or_s  src
+                ,  map           subst
+                ,  typename      T
+                ,  typename      s_
+                >
+        struct expr_<  src,  subst,  literal_or_s<  0,   T const  >, s_  >
+        :   subst_<  value_type< T{} >,  decltype(subst)  >
+        { };
+
+
+
+    public:
+
+        template<  literal_or_s  src
+                ,  map           subst
+                >
+        using expr =  typename expr_< src, subst >::type;
+    };
+
+
+
+    using nil = s<>;
+
+
+
+    template<  literal_or_s const  src
+            ,  map const           subst = map{}
+            >
+    using s_expr  =  typename s<>::template expr< src, subst>;
+
+
+
+    template< lt::text<>::literal expr  >
+    constexpr s_expr<expr> operator""_s_expr()  noexcept
+    {
+        return {};
+    }
+
+
+// PART I:  Symbolic Components
+
+
+// -----------------------------------------------------------------------------
+// class_template:
+// -----------------------------------------------------------------------------
+
+
+    template<  template< typename... >  class  >
+    struct ct {};
+
+
+
+    template<  template< typename... >  class F  >
+    using class_template  =  ct< F >;
+
+
+
+// -----------------------------------------------------------------------------
+// combinator:
+// -----------------------------------------------------------------------------
+
+    template<  unsigned n,  template< typename... >  class,  typename...  >
+    struct co {};
+
+
+
+    template<  unsigned                       n
+            ,  template< typename... > class  F
+            ,  typename...                    Prefix
+            >
+    using combinator  =  co<  n,  F,  Prefix...  >;
+
+
+
+// -----------------------------------------------------------------------------
+// Assign a type to a symbol:
+// -----------------------------------------------------------------------------
+
+
+    template<  typename K,  typename V  >
+    struct pair
+    {
+        using key    =  K;
+        using value  =  V;
+    };
+
+
+    template<  lt::text<>::literal symbol,  typename T  >
+    inline constexpr auto let = pair<  decltype(operator""_text<symbol>()),  T  >{};
+
+
+
+// PART II:  Lambda-Calculus
+
+
+    struct S {};  //  S represents the S-combinator  S = lambda xyz . xz(yz).
+    struct K {};  //  K represents the K-combinator  K = lambda xy.x.
+
+
+
+    template<  typename...  >
+    struct application;
+
+
+
+    template<>
+    struct application<>
+    {
+    private:
+
+        template<  typename...  >
+        friend struct application;
+
+
+        template<  typename X  >
+        using with_result  =  type_hull<X>;
+
+
+// Make opposite expression:
+
+        template<  typename... no_elements >
+        struct r_expr
+        {
+            static_assert( sizeof...(no_elements) == 0 );
+
+
+            using reverse = r_expr<>;
+
+
+            template<  typename X  >
+            using rcons = r_expr< X >;
+        };
+
+
+
+        template<  typename H,  typename... T  >
+        struct r_expr< H, T... >
+        {
+            using reverse =   typename r_expr< T... >::reverse::template rcons< H >;
+
+
+            template<  typename X  >
+            using rcons  = r_expr<  H,  T...,  X  >;
+        };
+
+
+
+        template<  typename X  >
+        struct opposite_expr
+        :   with_result<  X  >
+        { };
+
+
+
+        template<  typename     X
+                ,  typename...  Xs
+                >
+        struct opposite_expr<  s<  X,  Xs... >  >
+        :   with_result<  typename r_expr<  typename opposite_expr< X  >::type
+                                         ,  typename opposite_expr< Xs >::type...  >::
+                          reverse
+                       >
+        {
+            static_assert(sizeof...(Xs) != 0
+                         , "Forbidden nullary function call. No user-defined function f "
+                           "may be called without arguments via the expression (f)." );
+        };
+
+
+//  Apply variable to opposite expression
+
+
+        template<  typename,  typename   >
+        struct ap_;
+
+
+
+        template<  char... x  >
+        struct ap_<  text< x... >,  text< x... >  >
+        :   with_result<  s< S, K, K >  >
+        { };
+
+
+
+        template<  char...   x
+                ,  typename  Y
+                >
+        struct ap_< text<x...>,  Y  >
+        :   with_result<  s< K, Y  >  >
+        { };
+
+
+
+        template<  typename,  typename  >
+        struct combine_;
+
+
+
+        template<  char...   x
+                ,  typename  Q
+                ,  typename  P
+                >
+        struct ap_<  text<x...>,  r_expr<  Q,  P  >  >
+        :   combine_<  typename  ap_< text<x...>, P >::type
+                    ,  typename  ap_< text<x...>, Q >::type
+                    >
+        { };
+
+
+
+        template<  char...      x
+                ,  typename     Q
+                ,  typename     P
+                ,  typename...  Ps
+                >
+        struct ap_<  text<x...>,  r_expr<  Q,  P,  Ps...  >  >
+        :   combine_<  typename  ap_<  text<x...>,  r_expr<  P,  Ps... >  >::type
+                    ,  typename  ap_<  text<x...>,  Q  >::type
+                    >
+        { };
+
+
+
+        template<  typename P,  typename Q  >
+        struct combine_
+        :   with_result<  s< S,  P,  Q  >  >
+        { };
+
+
+
+
+        template<  typename P,  typename Q  >
+        struct combine_<  s< K, P >,  s< K, Q >  >
+        :   with_result<  s<  K,  s< P, Q >  >  >
+        { };
+
+
+
+        template<  typename     P
+                ,  typename...  Ps
+                ,  typename     Q
+                >
+        struct combine_<  s< K, s< P,  Ps... > >,  s< K, Q >  >
+        :   with_result<  s<  K,  s< P, Ps...,  Q >  >  >
+        { };
+
+
+
+        template<  typename     P  >
+        struct combine_<  s<  K,  P  >,  s< S, K, K >  >
+        :   with_result< P >
+        { };
+    };
+
+
+
+    template<  char...  X  >
+    struct application<  text< X... >  >
+    {
+        template<  typename Expr  >
+        using apply_to  =
+        typename application<>::
+        template ap_<  text< X... >
+
+                    ,  typename application<>::
+                       template opposite_expr<  Expr  >::
+                       type
+
+                    >::type;
+    };
+
+
+
+    template<  typename      X
+            ,  typename      Y
+            ,  typename...   Ys
+            >
+    requires
+    (
+        text_type<X>  &&
+        ( text_type<Y>  &&  ...  &&  text_type<Ys> )
+    )
+    struct application<  X,  Y,  Ys...  >
+    {
+        template<  typename  Expr  >
+        using apply_to  =
+        typename application<  X  >::
+        template apply_to<  typename application<  Y,  Ys...  >::
+                            template apply_to<  Expr  >
+                         >;
+    };
+
+
+}
@@ -9,7 +9,9 @@
 #pragma once
 
 
+#include <cstddef>
 #include <tuple>
+#include <utility>
 
 
 namespace lt::selftest
@@ -37,6 +39,18 @@ namespace lt::selftest
 
 
 
+//  configuration_space< n, X... > is the n-fold product of X...:  its configurations are
+//  the packs  pack< X_{d_0}, ..., X_{d_{n-1}} >,  numbered by  i = d_0 + m d_1 + m^2 d_2 + ...
+//  with m = sizeof...(X),  i.e. the first position varies fastest.
+//
+//      at< i >               the configuration i,  decoded from the digits of i in base m,
+//      slice< begin, end >   std::tuple of the configurations begin, ..., end - 1,
+//      list                  slice< 0, size >.
+//
+//  Neither at nor slice instantiates configurations outside of the requested range, so a
+//  large space can be split across several translation units, each applying a test to
+//  one slice of it.
+
     template<  unsigned,  typename...   >
     struct configuration_space;
 
@@ -51,30 +65,50 @@ namespace lt::selftest
         friend struct configuration_space;
 
 
-        template<  typename   >
-        struct configurations_generator;
 
+        template<  std::size_t m  >
+        static constexpr std::size_t power_(  std::size_t  k  )
+        {
+            std::size_t  p  =  1;
+
+            while ( k-- != 0 )
+                p *= m;
+
+            return p;
+        }
+
+
+
+        //  the configuration i,  Digits = std::index_sequence< 0, ..., n-1 >:
+
+        template<  std::size_t,  typename Digits,  typename... X  >
+        struct configuration_;
 
 
-        template<  typename... Packs  >
-        struct configurations_generator<  pack<  Packs... >  >
+
+        template<  std::size_t i,  std::size_t... k,  typename... X  >
+        struct configuration_<  i,  std::index_sequence< k... >,  X...  >
         {
-            template<  typename X  >
-            using push_back =   pack<  decltype(  Packs{} * pack< X >{} )...  >;
+            using type  =  pack<  typename pack< X... >::template at<  i / power_< sizeof...(X) >( k ) % sizeof...(X)  >...  >;
+        };
+
 
 
-            template<  typename... Xs  >
-            using add_dimension  =
-            configurations_generator< decltype(
-                    (   push_back< Xs >{} * ... * pack<>{}    )
-                                      ) >;
+        template<  unsigned,  std::size_t,  typename Offsets,  typename... X  >
+        struct slice_;
 
 
-                using list = std::tuple<  Packs...  >;
+
+        template<  unsigned n,  std::size_t begin,  std::size_t... j,  typename... X  >
+        struct slice_<  n,  begin,  std::index_sequence< j... >,  X...  >
+        {
+            using type  =  std::tuple<  typename configuration_<  begin + j,  std::make_index_sequence< n >,  X...  >::type...  >;
         };
 
     public:
 
+        static constexpr std::size_t size  =  0;
+
         using list = std::tuple<>;
 
    };
@@ -95,53 +129,34 @@ namespace lt::selftest
 
 
 
-    template<  typename...  X  >
+    template<  unsigned n,  typename...  X  >
     requires(    sizeof...(X) != 0  )
-    struct  configuration_space< 1u,  X...  >
+    struct  configuration_space<  n,  X...  >
     {
     private:
 
-        template<  unsigned,  typename...  >
-        friend struct configuration_space;
-
-
-        using generator  =
-            typename configuration_space<0u>::
-            template configurations_generator<  pack<  pack<X>...  >  >;
+        using base  =  configuration_space< 0u >;
 
 
     public:
 
+        static constexpr std::size_t size  =  base::power_< sizeof...(X) >( n );
 
-        using list  =  typename generator::list;
 
 
-        template<  unsigned n  >
-        using with_dimension =  configuration_space<  n,  X...  >;
+        template<  std::size_t i  >
+        requires(  i < size  )
+        using at  =  typename base::template configuration_<  i,  std::make_index_sequence< n >,  X...  >::type;
 
-    };
 
 
+        template<  std::size_t begin,  std::size_t end  >
+        requires(  begin <= end  &&  end <= size  )
+        using slice  =  typename base::template slice_<  n,  begin,  std::make_index_sequence<  end - begin  >,  X...  >::type;
 
-    template<  unsigned n,  typename...  X  >
-    requires(    sizeof...(X) != 0  )
-    struct  configuration_space<  n,  X...  >
-    {
-    private:
-
-        template<  unsigned,  typename...  >
-        friend struct configuration_space;
 
 
-        using generator  =
-        typename configuration_space<  n-1,  X...  >::
-        generator::
-        template add_dimension<  X... >;
-
-
-    public:
-
-        using list  =  typename generator::list;
+        using list  =  slice<  0,  size  >;
 
 
         template<  unsigned N  >
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <string_view>
+
 
 namespace lt
 {
@@ -254,4 +256,28 @@ namespace lt
                               text<>{}.operator==(T{});
                           };
 
+
+
+//  Runtime access:
+//
+//  to_string_view< text< x... > > is a std::string_view of x...  The characters are
+//  stored in one static constexpr array per distinct text;  being an inline variable, the
+//  array is shared by all translation units that use the same text.
+
+    template<  typename Text  >
+    struct text_storage_;
+
+
+    template<  char... x  >
+    struct text_storage_<  text< x... >  >
+    {
+        static constexpr char  chars[]  =  {  x...,  '\0'  };
+    };
+
+
+
+    template<  typename Text  >
+    requires text_type< Text >
+    inline constexpr std::string_view  to_string_view  {  text_storage_< Text >::chars,  sizeof( text_storage_< Text >::chars ) - 1  };
+
 }
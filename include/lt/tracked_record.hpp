@@ -0,0 +1,225 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#pragma once
+
+#include "lt/record.hpp"
+
+#include <bitset>
+#include <cstddef>
+#include <type_traits>
+
+
+
+namespace lt
+{
+//  Change tracking:
+//
+//  tracked_record< Entries... > is a record< Entries... > together with a dirty mask,
+//  a std::bitset with one bit per entry in declared order ( index_of( type_hull<Key> )
+//  is the position of Key ).  The mutable operator[] marks the entry as dirty, the const
+//  operator[] and values() do not.  Fixed entries are never dirty.
+//
+//  merge_dirty( other ) assigns only the dirty entries of other (moves them, if other
+//  is an rvalue) and marks them as dirty in *this;  the dirty mask of other is kept.
+//  for_each_dirty( f ) calls f( type_hull<Key>{}, value ) for the dirty entries in
+//  declared order, e.g. to send only the changed values.
+
+    template<  typename... Entries  >
+    requires map_parameters< Entries... >
+    struct tracked_record;
+
+
+
+    template<  typename...                        Key
+            ,  typename...                        Value
+            ,  template<  typename... > class...  Entry_t
+            >
+    requires
+        map_parameters<  Entry_t< Key, Value >...  >
+    struct tracked_record<  Entry_t< Key, Value >...  >
+    {
+    private:
+
+        template<  typename... Entries  >
+        requires map_parameters< Entries... >
+        friend struct tracked_record;
+
+
+
+        using record_t  =  record<  Entry_t< Key, Value >...  >;
+
+
+        static constexpr std::size_t  N  =  sizeof...(Key);
+
+
+
+        template<  typename K  >
+        static consteval std::size_t index_()
+        {
+            bool const match[] = {  type_hull< K >{} == type_hull< Key >{}...,  false  };
+
+            std::size_t i = 0;
+
+            while ( i != N  &&  ! match[ i ] )
+                ++i;
+
+            return i;
+        }
+
+
+
+        template<  typename K  >
+        static constexpr bool  stored_  =
+            (  (  type_hull< K >{} == type_hull< Key >{}
+                  &&
+                  type_hull<  Entry_t< Key, Value >  >{}  !=  type_hull<  fixed_entry_t< Key, Value >  >{}
+               )  ||  ...
+            );
+
+
+
+        record_t          values_;
+        std::bitset< N >  dirty_;
+
+
+
+        template<  typename K,  typename Other  >
+        void take_(  type_hull< K >  k,  Other&&  other  )
+        {
+            using other_t  =  std::remove_cvref_t< Other >;
+
+            if constexpr (  other_t::template stored_< K >  )
+            {
+                if ( other.dirty_[ other_t::template index_< K >() ] )
+                    (*this)[ k ] = static_cast< Other&& >( other ).values_[ k ];
+            }
+        }
+
+
+
+        template<  typename K,  typename F  >
+        void visit_(  type_hull< K >  k,  F&  f  )  const
+        {
+            if constexpr (  stored_< K >  )
+            {
+                if ( dirty_[ index_< K >() ] )
+                    f(  k,  values_[ k ]  );
+            }
+        }
+
+
+
+    public:
+
+        tracked_record()  =  default;
+
+
+        template<  typename... Constructor  >
+        requires
+        (
+            sizeof...(Constructor) != 0
+            &&
+            requires(  Constructor... c  ) {  (  c(),  ...  );  }
+        )
+        tracked_record(  Constructor... c  )
+        :   values_( c... )
+        { }
+
+
+        explicit tracked_record(  record_t const&  r  )
+        :   values_( r )
+        { }
+
+
+        explicit tracked_record(  record_t&&  r  )
+        :   values_(  r.move()  )
+        { }
+
+
+
+        template<  typename K  >
+        requires (  index_< K >() != N  )
+        decltype(auto)  operator[](  type_hull< K >  k  )  &
+        {
+            if constexpr (  stored_< K >  )
+                dirty_.set(  index_< K >()  );
+
+            return values_[ k ];
+        }
+
+
+        template<  typename K  >
+        requires (  index_< K >() != N  )
+        decltype(auto)  operator[](  type_hull< K >  k  )  const&
+        {
+            return values_[ k ];
+        }
+
+
+
+        record_t const&  values()  const noexcept {  return values_;  }
+
+
+
+        template<  typename K  >
+        requires (  index_< K >() != N  )
+        static constexpr std::size_t index_of(  type_hull< K >  )  noexcept
+        {
+            return index_< K >();
+        }
+
+
+
+        std::bitset< N > const&  dirty()  const noexcept {  return dirty_;  }
+
+
+        template<  typename K  >
+        requires (  index_< K >() != N  )
+        bool is_dirty(  type_hull< K >  )  const noexcept
+        {
+            return dirty_[ index_< K >() ];
+        }
+
+
+        void clear_dirty()  noexcept {  dirty_.reset();  }
+
+
+
+        template<  typename F  >
+        void for_each_dirty(  F&& f  )  const
+        {
+            (  visit_(  type_hull< Key >{},  f  ),  ...  );
+        }
+
+
+
+        template<  typename... Entries  >
+        tracked_record&  merge_dirty(  tracked_record< Entries... > const&  other  )
+        {
+            if ( static_cast< void const* >(this) != static_cast< void const* >(&other) ) [[likely]]
+            {
+                (  take_(  type_hull< typename Entries::key >{},  other  ),  ...  );
+            }
+            return *this;
+        }
+
+
+
+        template<  typename... Entries  >
+        tracked_record&  merge_dirty(  tracked_record< Entries... >&&  other  )
+        {
+            if ( static_cast< void const* >(this) != static_cast< void const* >(&other) ) [[likely]]
+            {
+                (  take_(  type_hull< typename Entries::key >{},  static_cast<  tracked_record< Entries... >&&  >( other )  ),  ...  );
+            }
+            return *this;
+        }
+    };
+}
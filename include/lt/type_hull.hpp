@@ -28,7 +28,7 @@ namespace lt
     template<  typename T
             ,  typename S
             >
-    static constexpr bool operator==(  type_hull< T >,  type_hull< S >  )
+    constexpr bool operator==(  type_hull< T >,  type_hull< S >  )
     {
         return false;
     }
@@ -36,7 +36,7 @@ namespace lt
 
 
     template<  typename T  >
-    static constexpr bool operator==(  type_hull< T >,  type_hull< T >  )
+    constexpr bool operator==(  type_hull< T >,  type_hull< T >  )
     {
         return true;
     }
@@ -11,7 +11,7 @@
 
 
 #include "text.hpp"
-#include "s_expr.hpp"
+#include "s_types.hpp"
 
 
 namespace lt
@@ -513,6 +513,305 @@ TRIVIUM_F_NE_CONSTRUCT(const volatile&&,  value_type<"const_volatile&&"_text> )
 
 
 
+//  batch transformations of template argument lists:
+//
+//  flatten_template, unique_types and sort_types_by rewrite the argument list of a
+//  class template instance F< Xs... > (or of its symbolic form, i.e.
+//  ( class_template @F Xs... ) ) in a single step: Concatenation is a fold over
+//  type_list::operator+, deduplication a fold over the bases of type_set and
+//  sorting a consteval sort of the keys followed by one pack expansion.
+
+        template<  unsigned...  >
+        struct index_sequence {};
+
+
+#ifdef _MSC_VER
+#pragma warning( push )
+#pragma warning( disable: 4067 )
+#endif
+
+//  disable "warning C4067: unexpected tokens following preprocessor directive - expected a newline"
+//  in the #if macro below:
+
+#if defined(_MSC_VER) || __has_builtin(__make_integer_seq)
+
+#ifdef _MSC_VER
+#pragma warning( pop )
+#endif
+
+        template<  typename T,  T...  k  >
+        struct index_sequence_
+        {
+            using seq = index_sequence< k... >;
+        };
+
+
+        template<  unsigned N  >
+        using make_index_sequence  =  typename __make_integer_seq<  index_sequence_,  unsigned,  N  >::seq;
+
+#elif __has_builtin(__integer_pack)
+
+        template<  unsigned N  >
+        using make_index_sequence  =  index_sequence<  __integer_pack(N)...  >;
+
+#else
+
+        template<  unsigned N,  unsigned... k  >
+        struct make_index_sequence_
+        :   make_index_sequence_<  N-1,  N-1,  k...  >
+        { };
+
+
+        template<  unsigned... k  >
+        struct make_index_sequence_<  0,  k...  >
+        :   type_hull<  index_sequence< k... >  >
+        { };
+
+
+        template<  unsigned N  >
+        using make_index_sequence  =  typename make_index_sequence_< N >::type;
+
+#endif
+
+
+
+        template<  unsigned k,  typename X  >
+        struct numbered
+        {
+            static type_hull< X >  at_(  value< k >  );
+        };
+
+
+
+        template<  typename,  typename...  >
+        struct numbered_seq_;
+
+
+
+        template<  unsigned...  k
+                ,  typename...  X
+                >
+        struct numbered_seq_<  index_sequence< k... >,  X...  >
+        :   numbered<  k,  X  >...
+        {
+            using numbered<  k,  X  >::at_...;
+
+
+            template<  unsigned n  >
+            using at  =  typename decltype(  at_(  value< n >{}  )  )::type;
+        };
+
+
+
+        template<  typename... Xs  >
+        struct type_list
+        {
+            template<  typename... Ys  >
+            type_list<  Xs...,  Ys...  >  operator+(  type_list< Ys... >  ) const;
+        };
+
+
+
+//  type_set< Xs... > + type_hull< X > appends X unless X is already a base:
+
+        template<  typename... Xs  >
+        struct type_set
+        :   type_hull< Xs >...
+        {
+            template<  typename X  >
+            type_set<  Xs...,  X  >  operator+(  type_hull< X >  ) const;
+
+
+            template<  typename X  >
+            requires requires(  type_set const* p  ) {  static_cast<  type_hull< X > const*  >( p );  }
+            type_set  operator+(  type_hull< X >  ) const;
+        };
+
+
+
+//  stable sort by descending key, returns the source position of every element:
+
+        template<  unsigned N  >
+        struct permutation
+        {
+            unsigned at[ N + 1 ];
+        };
+
+
+
+        template<  auto... key  >
+        static consteval permutation<  sizeof...(key)  >  descending_order()
+        {
+            constexpr unsigned N = sizeof...(key);
+
+            long long const k[] = {  static_cast< long long >( key )...,  0  };
+
+            permutation< N >  p{};
+
+            for ( unsigned i = 0;  i != N;  ++i )
+            {
+                unsigned  j = i;
+
+                for ( ;  j != 0  &&  k[ p.at[j-1] ] < k[ i ];  --j )
+                    p.at[ j ] = p.at[ j-1 ];
+
+                p.at[ j ] = i;
+            }
+
+            return p;
+        }
+
+
+
+        template<  auto x  >
+        static consteval auto  key_value(  value< x >  )  {  return x;  }
+
+
+
+        template<  typename  >
+        struct template_args_;
+
+
+
+        template<  template<  typename... > class  F
+                ,  typename...                     Xs
+                >
+        struct template_args_<  F<  Xs...  >  >
+        {
+            template<  typename... Ys  >
+            using rebuild  =  F<  Ys...  >;
+
+
+            template<  typename X  >
+            using cpp_type  =  X;
+
+
+            template<  typename X  >
+            struct flatten_
+            :   type_hull<  type_list< X >  >
+            { };
+
+
+            template<  typename... Ys  >
+            struct flatten_<  F<  Ys...  >  >
+            :   type_hull<  decltype(  (  type_list<>{}  +  ...  +  typename flatten_< Ys >::type{}  )  )  >
+            { };
+
+
+            using args  =  type_list<  Xs...  >;
+        };
+
+
+
+        template<  template<  typename... > class  F
+                ,  typename...                     Xs
+                >
+        struct template_args_<  s<  value_type<"class_template"_text>,  class_template< F >,  Xs...  >  >
+        {
+            template<  typename... Ys  >
+            using rebuild  =  s<  value_type<"class_template"_text>,  class_template< F >,  Ys...  >;
+
+
+            template<  typename X  >
+            using cpp_type  =  typename cpp_type_from_symbolic_< X >::type;
+
+
+            template<  typename X  >
+            struct flatten_
+            :   type_hull<  type_list< X >  >
+            { };
+
+
+            template<  typename... Ys  >
+            struct flatten_<  s<  value_type<"class_template"_text>,  class_template< F >,  Ys...  >  >
+            :   type_hull<  decltype(  (  type_list<>{}  +  ...  +  typename flatten_< Ys >::type{}  )  )  >
+            { };
+
+
+            using args  =  type_list<  Xs...  >;
+        };
+
+
+
+        template<  typename T
+                ,  typename Args = typename template_args_< T >::args
+                >
+        struct flatten_template_;
+
+
+
+        template<  typename T,  typename... Xs  >
+        struct flatten_template_<  T,  type_list< Xs... >  >
+        {
+            template<  typename... Ys  >
+            static type_hull<  typename template_args_< T >::template rebuild< Ys... >  >
+            rebuild_(  type_list< Ys... >  );
+
+
+            using type  =
+            typename decltype(
+                rebuild_(  (  type_list<>{}  +  ...  +  typename template_args_< T >::template flatten_< Xs >::type{}  )  )
+            )::type;
+        };
+
+
+
+        template<  typename T
+                ,  typename Args = typename template_args_< T >::args
+                >
+        struct unique_types_;
+
+
+
+        template<  typename T,  typename... Xs  >
+        struct unique_types_<  T,  type_list< Xs... >  >
+        {
+            template<  typename... Ys  >
+            static type_hull<  typename template_args_< T >::template rebuild< Ys... >  >
+            rebuild_(  type_set< Ys... >  );
+
+
+            using type  =  typename decltype(  rebuild_(  (  type_set<>{}  +  ...  +  type_hull< Xs >{}  )  )  )::type;
+        };
+
+
+
+        template<  typename Key
+                ,  typename T
+                ,  typename Args = typename template_args_< T >::args
+                >
+        struct sort_types_by_;
+
+
+
+        template<  template<  typename... > class  K
+                ,  typename...                     Prefix
+                ,  typename                        T
+                ,  typename...                     Xs
+                >
+        struct sort_types_by_<  combinator<  1,  K,  Prefix...  >,  T,  type_list< Xs... >  >
+        {
+            using args_  =  template_args_< T >;
+
+
+            static constexpr auto  order  =
+            descending_order<  key_value(  K<  Prefix...,  typename args_::template cpp_type< Xs >  >{}  )...  >();
+
+
+            template<  unsigned... i  >
+            static type_hull<
+                typename args_::template rebuild<
+                    typename numbered_seq_<  make_index_sequence< sizeof...(Xs) >,  Xs...  >::template at<  order.at[i]  >...
+                >
+            >
+            sort_(  index_sequence< i... >  );
+
+
+            using type  =  typename decltype(  sort_(  make_index_sequence< sizeof...(Xs) >{}  )  )::type;
+        };
+
+
+
     public:
 
         template<  typename CppType  >
@@ -532,5 +831,31 @@ TRIVIUM_F_NE_CONSTRUCT(const volatile&&,  value_type<"const_volatile&&"_text> )
 
         template<  typename CppType  >
         using alignof_ = integer<alignof(CppType)>;
+
+
+
+//  flatten_template< T >:    splices nested instances of the same class template into the
+//                            argument list, e.g.  V< a, V< b, V< c > > >  ->  V< a, b, c >.
+//
+//  unique_types< T >:        removes repeated arguments, keeping the first occurrence.
+//
+//  sort_types_by< Key, T >:  stable sort of the arguments by descending  Key< argument >,
+//                            where Key is a unary combinator yielding an integral value,
+//                            e.g. combinator< 1, alignof_ >.
+//
+//  T is either a class template instance or its symbolic form.
+
+        template<  typename T  >
+        using flatten_template  =  typename flatten_template_< T >::type;
+
+
+
+        template<  typename T  >
+        using unique_types  =  typename unique_types_< T >::type;
+
+
+
+        template<  typename Key,  typename T  >
+        using sort_types_by  =  typename sort_types_by_<  Key,  T  >::type;
     };
 }
@@ -0,0 +1,76 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Compile-time benchmark:  take apart and rebuild an integer list of n elements and
+//  sum it up.
+//
+//  The input is the packed list  lt::packed< 0, 1, ..., n-1 >.
+//
+//  -DTRIVIUM_BENCH_N=<n>          number of elements
+//  -DTRIVIUM_BENCH_LISP_BASELINE  the same program on the unpacked list
+//                                 s< integer<0>, ..., integer<n-1> >  (use small n only)
+//  -DTRIVIUM_BENCH_MODULES        import lt.eval instead of including lt/eval.hpp
+//                                 (make ct-packed-list-modules)
+
+
+#ifdef TRIVIUM_BENCH_MODULES
+import lt.eval;
+#else
+#include "lt/eval.hpp"
+#endif
+
+#include <type_traits>
+#include <utility>
+
+
+#ifndef TRIVIUM_BENCH_N
+#define TRIVIUM_BENCH_N 100
+#endif
+
+
+constexpr int n  =  TRIVIUM_BENCH_N;
+
+
+template<  int... i  >
+lt::packed< i... >  input_(  std::integer_sequence<  int,  i...  >  );
+
+
+using packed_input  =  decltype(  input_(  std::make_integer_sequence<  int,  n  >{}  )  );
+
+
+
+#ifndef TRIVIUM_BENCH_LISP_BASELINE
+
+using input  =  packed_input;
+
+#else
+
+using input  =  lt::metaprogram< "[xs]( unpack xs )",  packed_input >;
+
+#endif
+
+
+
+using output  =
+lt::metaprogram<
+R"( [xs]
+    {
+        (   def 'rotate [xs]  ( rcons ( first xs ) ( drop_first xs ) )  )
+
+        ( fold + 0 ( rotate ( rotate xs ) ) )
+    }
+)"
+,   input
+>;
+
+
+static_assert(  std::is_same_v<  output,  lt::integer<  n * ( n - 1 ) / 2  >  >  );
+
+
+
+int main() {}
@@ -0,0 +1,63 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Compile-time benchmark:  a recursive integer definition of recursion depth n,
+//
+//      ( def 'sum [k]  ( if ( == k 0 ) 0 ( + k ( sum ( - k 1 ) ) ) ) )
+//
+//  evaluated by the consteval reducer for pure integer definitions.
+//
+//  -DTRIVIUM_BENCH_N=<n>          recursion depth
+//  -DTRIVIUM_BENCH_LISP_BASELINE  the same program evaluated with the Y-combinator
+//                                 (TRIVIUM_NO_CONSTEVAL_DEF,  use small n only)
+//
+//  The reducer takes about 50 steps per level,  large n need a raised constexpr limit
+//  of the compiler (the Makefile passes -fconstexpr-steps).  make ct-pure-def-crossover
+//  compiles both variants for the same n.
+
+
+#ifndef TRIVIUM_BENCH_N
+#define TRIVIUM_BENCH_N 100
+#endif
+
+
+#ifdef TRIVIUM_BENCH_LISP_BASELINE
+#define TRIVIUM_NO_CONSTEVAL_DEF
+#endif
+
+
+#define TRIVIUM_CONSTEVAL_DEF_STEPS  ( 100l * TRIVIUM_BENCH_N + 1000 )
+
+
+#include "lt/eval.hpp"
+
+#include <type_traits>
+
+
+constexpr int n  =  TRIVIUM_BENCH_N;
+
+
+
+using output  =
+lt::metaprogram<
+R"( [n]
+    {
+        (   def 'sum [k]  ( if ( == k 0 ) 0 ( + k ( sum ( - k 1 ) ) ) )  )
+
+        ( sum n )
+    }
+)"
+,   lt::integer< n >
+>;
+
+
+static_assert(  std::is_same_v<  output,  lt::integer<  n * ( n + 1 ) / 2  >  >  );
+
+
+
+int main() {}
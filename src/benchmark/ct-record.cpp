@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Compile-time benchmark:  a record with n fields is constructed from n arguments
+//  (given in reverse order), read with operator[], passed to invoke and assigned with
+//  operator<<= to a record with the same entries in a different order.
+//
+//  -DTRIVIUM_BENCH_N=<n>        number of fields
+//  -DTRIVIUM_BENCH_MODULES      import lt.record instead of including lt/record.hpp
+//                               (make ct-record-modules)
+//
+//  (There is no Trivium Lisp baseline;  TRIVIUM_BENCH_LISP_BASELINE is ignored.)
+
+
+#ifdef TRIVIUM_BENCH_MODULES
+import lt.record;
+#else
+#include "lt/record.hpp"
+#endif
+
+#include <utility>
+
+
+#ifndef TRIVIUM_BENCH_N
+#define TRIVIUM_BENCH_N 100
+#endif
+
+
+constexpr unsigned n  =  TRIVIUM_BENCH_N;
+
+
+template<  unsigned i  >
+struct key {};
+
+
+
+template<  unsigned... i  >
+lt::record<  lt::entry_t<  key< i >,  int  >...  >
+record_(  std::integer_sequence<  unsigned,  i...  >  );
+
+
+template<  unsigned... i  >
+lt::record<  lt::entry_t<  key< n - 1 - i >,  int  >...  >
+reversed_(  std::integer_sequence<  unsigned,  i...  >  );
+
+
+using record_t    =  decltype(  record_(  std::make_integer_sequence<  unsigned,  n  >{}  )  );
+using reversed_t  =  decltype(  reversed_(  std::make_integer_sequence<  unsigned,  n  >{}  )  );
+
+
+
+template<  unsigned... i  >
+int test_(  std::integer_sequence<  unsigned,  i...  >  )
+{
+    record_t  r{  lt::argument(  lt::type_hull<  key< n - 1 - i >  >{},  int( i )  )...  };
+
+    reversed_t  s;
+    s <<= r;
+
+    return  s.invoke(  []( auto... x ) {  return ( x + ... );  }  )
+            +
+            ( r[ lt::type_hull< key< i > >{} ] + ... );
+}
+
+
+
+int test()
+{
+    return test_(  std::make_integer_sequence<  unsigned,  n  >{}  );
+}
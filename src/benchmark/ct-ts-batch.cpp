@@ -0,0 +1,105 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Compile-time benchmark:  flatten, deduplicate and sort the alternatives of a
+//  variant-like class template with n distinct alternatives.
+//
+//  The input is  variant_< alt<i % (n/2)>...,  variant_< alt<i>... > >  for i in [0, n),
+//  i.e. 2n arguments, one level of nesting and n/2 duplicates.
+//
+//  -DTRIVIUM_BENCH_N=<n>          number of distinct alternatives
+//  -DTRIVIUM_BENCH_LISP_BASELINE  deduplicate with a recursive Trivium Lisp walk instead
+//                                 of unique_types (quadratic; use small n only)
+
+
+#include "lt/lib/ts.hpp"
+
+#include <utility>
+
+
+#ifndef TRIVIUM_BENCH_N
+#define TRIVIUM_BENCH_N 100
+#endif
+
+
+constexpr unsigned n  =  TRIVIUM_BENCH_N;
+
+
+template<  unsigned i  >
+struct alignas(  1u << ( i % 4 )  )  alt
+{
+    char c[  i % 3  +  1  ];
+};
+
+
+
+template<  typename...  >
+struct variant_ {};
+
+
+
+template<  unsigned... i  >
+variant_<  alt<  i % ( n/2 )  >...,  variant_<  alt< i >...  >  >
+input_(  std::integer_sequence<  unsigned,  i...  >  );
+
+
+using input  =  decltype(  input_(  std::make_integer_sequence<  unsigned,  n  >{}  )  );
+
+
+
+#ifndef TRIVIUM_BENCH_LISP_BASELINE
+
+using output  =
+lt::lib::ts::metaprogram< "[t]( sort_types_by alignof ( unique_types ( flatten_template t ) ) )",  input  >;
+
+#else
+
+using output  =
+lt::lib::ts::metaprogram<
+R"( [t]
+    {
+        (   def 'contains [x xs]
+            (   if  ( eq xs () )
+                    false
+                    ( if  ( eq x ( first xs ) )  true  ( contains x ( drop_first xs ) ) )
+            )
+        )
+
+        (   def 'dedupe [xs acc]
+            (   if  ( eq xs () )
+                    acc
+                    (   dedupe  ( drop_first xs )
+                                ( if ( contains ( first xs ) acc )  acc  ( rcons ( first xs ) acc ) )
+                    )
+            )
+        )
+
+        ( def 'v ( flatten_template ( cpp_to_lisp t ) ) )      ; ( class_template @variant_ alternatives... )
+
+        (   lisp_to_cpp
+            (   cons  ( first v )
+                      ( cons  ( first ( drop_first v ) )  ( dedupe ( drop_first ( drop_first v ) )  () ) )
+            )
+        )
+    }
+)"
+,   input
+>;
+
+#endif
+
+
+
+template<  typename... Xs  >
+consteval unsigned  alternatives(  variant_< Xs... > const*  )  {  return sizeof...(Xs);  }
+
+static_assert(  alternatives(  static_cast<  output const*  >( nullptr )  )  ==  n  );
+
+
+
+int main() {}
@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Runtime benchmark:  reader scaling of concurrent_record.  One writer publishes records
+//  continuously while 1, 2, 4, ... 64 readers take snapshots for TRIVIUM_BENCH_MS
+//  milliseconds (default 200).  The same is done with a record guarded by a std::mutex.
+//  Reported are the snapshots per second of all readers together.
+
+
+#include "lt/concurrent_record.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+#ifndef TRIVIUM_BENCH_MS
+#define TRIVIUM_BENCH_MS 200
+#endif
+
+
+using lt::operator""_text;
+using lt::operator""_index;
+
+using lt::entry;
+using lt::arg;
+
+
+using record_t  =  lt::record<  entry< "x", double >,  entry< "y", double >,  entry< "z", double >,  entry< "tick", long >  >;
+
+
+
+struct seqlock_
+{
+    lt::concurrent_record<  entry< "x", double >,  entry< "y", double >,  entry< "z", double >,  entry< "tick", long >  >  shared;
+
+    void      store(  record_t const&  r  )  {  shared.store( r );  }
+    record_t  snapshot()  const             {  return shared.snapshot();  }
+};
+
+
+
+struct mutex_
+{
+    mutable std::mutex  m;
+    record_t            shared;
+
+    void store(  record_t const&  r  )
+    {
+        std::lock_guard< std::mutex >  lock( m );
+        shared <<= r;
+    }
+
+    record_t snapshot()  const
+    {
+        std::lock_guard< std::mutex >  lock( m );
+        return shared;
+    }
+};
+
+
+
+template<  typename Shared  >
+double snapshots_per_second(  unsigned  readers  )
+{
+    Shared                     shared;
+    std::atomic< bool >        stop{ false };
+    std::atomic< long >        total{ 0 };
+    std::vector< std::thread > threads;
+
+    for ( unsigned k = 0;  k != readers;  ++k )
+        threads.emplace_back(  [&]
+        {
+            long   n    =  0;
+            double sum  =  0;
+
+            for ( ;  ! stop.load( std::memory_order_relaxed );  ++n )
+                sum += shared.snapshot()[ "x"_index ];
+
+            total += n + ( sum < 0 );
+        } );
+
+    std::thread writer(  [&]
+    {
+        for ( long tick = 0;  ! stop.load( std::memory_order_relaxed );  ++tick )
+            shared.store(  record_t{  arg<"x">( 1.0 * tick ),  arg<"y">( 0.0 ),  arg<"z">( 0.0 ),  arg<"tick">( tick )  }  );
+    } );
+
+
+    std::this_thread::sleep_for(  std::chrono::milliseconds( TRIVIUM_BENCH_MS )  );
+    stop = true;
+
+    writer.join();
+
+    for ( auto& t : threads )
+        t.join();
+
+    return  total * 1000.0 / TRIVIUM_BENCH_MS;
+}
+
+
+
+int main()
+{
+    std::printf(  "%8s  %16s  %16s\n",  "readers",  "seqlock / s",  "mutex / s"  );
+
+    for ( unsigned readers = 1;  readers <= 64;  readers *= 2 )
+        std::printf(  "%8u  %16.0f  %16.0f\n"
+                   ,  readers
+                   ,  snapshots_per_second< seqlock_ >( readers )
+                   ,  snapshots_per_second< mutex_ >( readers )
+                   );
+}
@@ -0,0 +1,118 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Runtime benchmark:  dispatch over 128 alternatives by a runtime tag.  10M random tags
+//  are dispatched with lt::dispatch_table (one indirect call), with std::visit on a
+//  std::variant of the alternatives and with a chain of comparisons (fold over ||).
+
+
+#include "lt/dispatch.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <utility>
+#include <variant>
+#include <vector>
+
+
+constexpr std::size_t  n  =  128;
+
+
+
+template<  std::size_t i  >
+struct alternative
+{
+    static unsigned apply(  unsigned x  )  noexcept {  return x * ( 2 * i + 1 ) + i;  }
+};
+
+
+
+template<  std::size_t... i  >
+lt::s<  alternative< i >...  >         list_(  std::index_sequence< i... >  );
+
+template<  std::size_t... i  >
+std::variant<  alternative< i >...  >  variant_(  std::index_sequence< i... >  );
+
+
+using list_t     =  decltype(  list_(  std::make_index_sequence< n >{}  )  );
+using variant_t  =  decltype(  variant_(  std::make_index_sequence< n >{}  )  );
+
+
+
+template<  std::size_t... i  >
+unsigned chain_(  std::size_t tag,  unsigned x,  std::index_sequence< i... >  )
+{
+    unsigned r = 0;
+    (void)(  (  tag == i  &&  (  r = alternative< i >::apply( x ),  true  )  )  ||  ...  );
+    return r;
+}
+
+
+
+template<  std::size_t... i  >
+std::vector< variant_t > variants_(  std::vector< std::size_t > const&  tags,  std::index_sequence< i... >  )
+{
+    variant_t const  prototypes[]  =  {  variant_t(  std::in_place_index< i >  )...  };
+
+    std::vector< variant_t >  v;
+
+    for ( auto t : tags )
+        v.push_back(  prototypes[ t ]  );
+
+    return v;
+}
+
+
+
+template<  typename F  >
+void run(  char const*  name,  std::size_t  count,  F  f  )
+{
+    auto const start = std::chrono::steady_clock::now();
+
+    unsigned x = 1;
+
+    for ( std::size_t k = 0;  k != count;  ++k )
+        x = f( k,  x );
+
+    std::chrono::duration< double, std::milli > const t = std::chrono::steady_clock::now() - start;
+
+    std::printf(  "%-16s  %8.1f ms  %6.2f ns / call  (%u)\n",  name,  t.count(),  t.count() * 1e6 / count,  x  );
+}
+
+
+
+int main()
+{
+    std::vector< std::size_t >  tags;
+
+    unsigned r = 1;
+
+    for ( int k = 0;  k != 10'000'000;  ++k )
+    {
+        r = r * 1103515245u + 12345u;
+        tags.push_back(  ( r >> 8 ) % n  );
+    }
+
+    std::vector< variant_t > const  variants  =  variants_(  tags,  std::make_index_sequence< n >{}  );
+
+
+    run(  "dispatch_table",  tags.size(),  [&]( std::size_t k,  unsigned x )
+    {
+        return lt::dispatch_table< list_t >::visit(  tags[ k ],  []< typename A >(  lt::type_hull< A >,  unsigned y  ) {  return A::apply( y );  },  x  );
+    } );
+
+    run(  "std::visit",  tags.size(),  [&]( std::size_t k,  unsigned x )
+    {
+        return std::visit(  [=]< typename A >(  A  ) {  return A::apply( x );  },  variants[ k ]  );
+    } );
+
+    run(  "if-chain",  tags.size(),  [&]( std::size_t k,  unsigned x )
+    {
+        return chain_(  tags[ k ],  x,  std::make_index_sequence< n >{}  );
+    } );
+}
@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Runtime benchmark:  lookup of 64 command names.  10M names (90% hits, 10% misses) are
+//  looked up with lt::perfect_hash, with std::unordered_map< std::string_view, unsigned >
+//  and with a binary search in a sorted array.
+
+
+#include "lt/perfect_hash.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+using lt::operator""_text;
+
+
+#define TRIVIUM_KEYS( X )                                                                       \
+    X( "add" )        X( "am" )         X( "annotate" )   X( "apply" )      X( "archive" )      \
+    X( "bisect" )     X( "blame" )      X( "branch" )     X( "bundle" )     X( "cat-file" )     \
+    X( "checkout" )   X( "cherry" )     X( "citool" )     X( "clean" )      X( "clone" )        \
+    X( "commit" )     X( "config" )     X( "count" )      X( "describe" )   X( "diff" )         \
+    X( "difftool" )   X( "fetch" )      X( "filter" )     X( "format" )     X( "fsck" )         \
+    X( "gc" )         X( "grep" )       X( "gui" )        X( "help" )       X( "init" )         \
+    X( "instaweb" )   X( "log" )        X( "ls-files" )   X( "ls-remote" )  X( "ls-tree" )      \
+    X( "merge" )      X( "mergetool" )  X( "mv" )         X( "notes" )      X( "prune" )        \
+    X( "pull" )       X( "push" )       X( "range-diff" ) X( "rebase" )     X( "reflog" )       \
+    X( "remote" )     X( "repack" )     X( "replace" )    X( "request" )    X( "reset" )        \
+    X( "restore" )    X( "revert" )     X( "rev-list" )   X( "rev-parse" )  X( "rm" )           \
+    X( "send-email" ) X( "shortlog" )   X( "show" )       X( "sparse" )     X( "stash" )        \
+    X( "status" )     X( "submodule" )  X( "switch" )     X( "tag" )
+
+
+#define TRIVIUM_TYPE( s )    , decltype( s##_text )
+#define TRIVIUM_STRING( s )  s,
+
+template<  typename,  typename... Texts  >
+using perfect_hash_of  =  lt::perfect_hash< Texts... >;
+
+using commands  =  perfect_hash_of<  void  TRIVIUM_KEYS( TRIVIUM_TYPE )  >;
+
+constexpr std::string_view  names[]  =  {  TRIVIUM_KEYS( TRIVIUM_STRING )  };
+
+constexpr std::size_t  n  =  sizeof( names ) / sizeof( names[ 0 ] );
+
+static_assert(  commands::size == n  );
+
+
+
+template<  typename Find  >
+void run(  char const*  name,  std::vector< std::string_view > const&  queries,  Find  find  )
+{
+    auto const start = std::chrono::steady_clock::now();
+
+    std::size_t sum = 0;
+
+    for ( int pass = 0;  pass != 10;  ++pass )
+        for ( auto q : queries )
+            sum += find( q );
+
+    std::chrono::duration< double, std::milli > const t = std::chrono::steady_clock::now() - start;
+
+    std::printf(  "%-16s  %8.1f ms  %6.2f ns / lookup  (%zu)\n",  name,  t.count(),  t.count() * 1e6 / ( 10.0 * queries.size() ),  sum  );
+}
+
+
+
+int main()
+{
+    std::vector< std::string_view >  queries;
+
+    unsigned x = 1;
+
+    for ( int k = 0;  k != 1'000'000;  ++k )
+    {
+        x = x * 1103515245u + 12345u;
+
+        std::string_view const s = names[ ( x >> 8 ) % n ];
+
+        queries.push_back(  ( x >> 4 ) % 10 == 0  ?  s.substr( 1 )  :  s  );        // 10% (mostly) misses
+    }
+
+
+    std::unordered_map< std::string_view, std::size_t >  map;
+
+    for ( std::size_t k = 0;  k != n;  ++k )
+        map.emplace(  names[ k ],  k  );
+
+
+    std::vector< std::pair< std::string_view, std::size_t > >  sorted;
+
+    for ( std::size_t k = 0;  k != n;  ++k )
+        sorted.emplace_back(  names[ k ],  k  );
+
+    std::sort(  sorted.begin(),  sorted.end()  );
+
+
+    run(  "perfect_hash",  queries,  []( std::string_view s ) {  return commands::find( s );  }  );
+
+    run(  "unordered_map",  queries,  [&]( std::string_view s )
+    {
+        auto const i = map.find( s );
+        return  i == map.end()  ?  n  :  i->second;
+    } );
+
+    run(  "binary search",  queries,  [&]( std::string_view s )
+    {
+        auto const i = std::lower_bound(  sorted.begin(),  sorted.end(),  s,  []( auto const& e,  std::string_view s ) {  return e.first < s;  }  );
+        return  i == sorted.end() || i->first != s  ?  n  :  i->second;
+    } );
+}
@@ -0,0 +1,95 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Runtime benchmark:  evaluation of  ( add ( mul a x ) y )  for 1M records, once with
+//  record::eval for every element of a std::vector of records and once with the batched
+//  evaluation over record_columns.
+
+
+#include "lt/record_columns.hpp"
+#include "lt/s_expr.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+
+using lt::operator""_text;
+
+using lt::entry;
+using lt::fixed_entry;
+using lt::arg;
+
+
+
+using row_t      =  lt::record<  entry< "a", double >,  entry< "x", double >,  entry< "y", double >,  entry< "id", long >
+                              ,  fixed_entry< "add", std::plus<> >,  fixed_entry< "mul", std::multiplies<> >
+                              >;
+
+using columns_t  =  lt::record_columns<  entry< "a", double >,  entry< "x", double >,  entry< "y", double >,  entry< "id", long >
+                                      ,  fixed_entry< "add", std::plus<> >,  fixed_entry< "mul", std::multiplies<> >
+                                      >;
+
+using program    =  lt::s_expr< "( add ( mul a x ) y )" >;
+
+
+
+constexpr std::size_t  rows        =  1'000'000;
+constexpr int          iterations  =  20;
+
+
+
+template<  typename Records  >
+double run(  char const*  name,  Records const&  records  )
+{
+    std::vector< double >  out( rows );
+
+    auto const start = std::chrono::steady_clock::now();
+
+    for ( int k = 0;  k != iterations;  ++k )
+        lt::eval_batch(  program{},  records,  out  );
+
+    auto const stop = std::chrono::steady_clock::now();
+
+    std::printf(  "%-28s %8.3f ms / pass\n"
+               ,  name
+               ,  std::chrono::duration< double, std::milli >( stop - start ).count() / iterations
+               );
+
+    double checksum = 0;
+
+    for ( double x : out )
+        checksum += x;
+
+    return checksum;
+}
+
+
+
+int main()
+{
+    std::vector< row_t >  records;
+    columns_t             columns;
+
+    records.reserve( rows );
+    columns.reserve( rows );
+
+    for ( std::size_t n = 0;  n != rows;  ++n )
+    {
+        row_t r{  arg<"a">( 0.5 ),  arg<"x">( double( n % 1000 ) ),  arg<"y">( 1.0 ),  arg<"id">( long( n ) )  };
+
+        records.push_back( r );
+        columns.push_back( r );
+    }
+
+    double const aos = run(  "record::eval (array)",      records  );
+    double const soa = run(  "eval_batch (record_columns)",  columns  );
+
+    return aos == soa ? 0 : 1;
+}
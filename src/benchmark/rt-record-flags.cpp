@@ -0,0 +1,78 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Runtime benchmark:  flag-heavy records.  4M records with eight flags are scanned for
+//  the number of records with a given combination of flags, once with bit_entry (one
+//  byte per record) and once with bool entries (eight bytes per record).
+
+
+#include "lt/record.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+
+using lt::operator""_text;
+using lt::operator""_index;
+
+using lt::entry;
+using lt::bit_entry;
+using lt::arg;
+
+
+
+using bits_t   =  lt::record<  bit_entry< "a" >,  bit_entry< "b" >,  bit_entry< "c" >,  bit_entry< "d" >
+                            ,  bit_entry< "e" >,  bit_entry< "f" >,  bit_entry< "g" >,  bit_entry< "h" >
+                            >;
+
+using bools_t  =  lt::record<  entry< "a", bool >,  entry< "b", bool >,  entry< "c", bool >,  entry< "d", bool >
+                            ,  entry< "e", bool >,  entry< "f", bool >,  entry< "g", bool >,  entry< "h", bool >
+                            >;
+
+
+
+template<  typename Record  >
+void run(  char const*  name  )
+{
+    std::vector< Record >  v( 1 << 22 );
+
+    unsigned x = 1;
+
+    for ( auto& r : v )
+    {
+        x = x * 1103515245u + 12345u;
+
+        r[ "a"_index ] = x & 1 << 16;    r[ "b"_index ] = x & 1 << 17;
+        r[ "c"_index ] = x & 1 << 18;    r[ "d"_index ] = x & 1 << 19;
+        r[ "e"_index ] = x & 1 << 20;    r[ "f"_index ] = x & 1 << 21;
+        r[ "g"_index ] = x & 1 << 22;    r[ "h"_index ] = x & 1 << 23;
+    }
+
+
+    auto const start = std::chrono::steady_clock::now();
+
+    long n = 0;
+
+    for ( int pass = 0;  pass != 20;  ++pass )
+        for ( auto const& r : v )
+            n += r[ "a"_index ] && ! r[ "c"_index ] && r[ "h"_index ];
+
+    std::chrono::duration< double, std::milli > const t = std::chrono::steady_clock::now() - start;
+
+
+    std::printf(  "%-12s  %2zu bytes / record  %8.1f ms  (%ld)\n",  name,  sizeof( Record ),  t.count(),  n  );
+}
+
+
+
+int main()
+{
+    run< bits_t >( "bit_entry" );
+    run< bools_t >( "bool entry" );
+}
@@ -0,0 +1,155 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Runtime benchmark:  records as keys of hash maps.  1M records are inserted into and
+//  looked up in a flat open-addressing map (linear probing) and in std::unordered_map,
+//  once for a padding-free key (hashed as a block of bytes) and once for a key with a
+//  double entry (hashed entry by entry).
+
+
+#include "lt/record_hash.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <unordered_map>
+#include <vector>
+
+
+using lt::operator""_text;
+using lt::operator""_index;
+
+using lt::entry;
+using lt::arg;
+
+
+
+template<  typename Key,  typename Value  >
+struct flat_map
+{
+    std::vector< Key >    keys;
+    std::vector< Value >  values;
+    std::vector< bool >   used;
+    std::size_t           mask;
+
+
+    explicit flat_map(  std::size_t capacity  )         // capacity: power of 2
+    :   keys( capacity ),  values( capacity ),  used( capacity ),  mask( capacity - 1 )
+    { }
+
+
+    std::size_t slot(  Key const&  k  )  const
+    {
+        std::size_t n = lt::record_hash{}( k ) & mask;
+
+        while ( used[ n ]  &&  ! ( keys[ n ] == k ) )
+            n = ( n + 1 ) & mask;
+
+        return n;
+    }
+
+
+    void insert(  Key const&  k,  Value  v  )
+    {
+        std::size_t const n = slot( k );
+
+        keys[ n ]   <<=  k;
+        values[ n ]  =  v;
+        used[ n ]    =  true;
+    }
+
+
+    Value const* find(  Key const&  k  )  const
+    {
+        std::size_t const n = slot( k );
+
+        return used[ n ]  ?  &values[ n ]  :  nullptr;
+    }
+};
+
+
+
+constexpr std::size_t  count  =  1'000'000;
+
+
+
+template<  typename Map,  typename Key  >
+void run(  char const*  name,  Map&  map,  std::vector< Key > const&  keys  )
+{
+    auto const t0 = std::chrono::steady_clock::now();
+
+    for ( std::size_t n = 0;  n != keys.size();  ++n )
+        map.insert( { keys[ n ],  long( n ) } );
+
+    auto const t1 = std::chrono::steady_clock::now();
+
+    long found = 0;
+
+    for ( auto const& k : keys )
+    {
+        if constexpr (  requires {  map.find( k )->second;  }  )
+            found += map.find( k )->second;
+        else
+            found += *map.find( k );
+    }
+
+    auto const t2 = std::chrono::steady_clock::now();
+
+    std::printf(  "%-44s insert %7.2f ms   find %7.2f ms   (%ld)\n"
+               ,  name
+               ,  std::chrono::duration< double, std::milli >( t1 - t0 ).count()
+               ,  std::chrono::duration< double, std::milli >( t2 - t1 ).count()
+               ,  found
+               );
+}
+
+
+
+template<  typename Key  >
+struct flat_map_adapter
+:   flat_map<  Key,  long  >
+{
+    using flat_map<  Key,  long  >::flat_map;
+
+    void insert(  std::pair< Key, long > const&  kv  )  {  flat_map< Key, long >::insert( kv.first,  kv.second );  }
+};
+
+
+
+template<  typename Key  >
+void run_all(  char const*  flat_name,  char const*  std_name,  std::vector< Key > const&  keys  )
+{
+    flat_map_adapter< Key >                             flat(  std::size_t( 1 ) << 21  );
+    std::unordered_map<  Key,  long,  lt::record_hash  >  map;
+
+    run(  flat_name,  flat,  keys  );
+    run(  std_name,   map,   keys  );
+}
+
+
+
+int main()
+{
+    using bytes_key   =  lt::record<  entry< "a", int >,  entry< "b", int >,  entry< "c", long >  >;
+    using fields_key  =  lt::record<  entry< "a", int >,  entry< "x", double >  >;
+
+    static_assert(  std::has_unique_object_representations_v< bytes_key >  );
+
+
+    std::vector< bytes_key >   bytes_keys;
+    std::vector< fields_key >  fields_keys;
+
+    for ( std::size_t n = 0;  n != count;  ++n )
+    {
+        bytes_keys.push_back(  bytes_key{  arg<"a">( int( n % 1000 ) ),  arg<"b">( int( n / 1000 ) ),  arg<"c">( long( n * 7 ) )  }  );
+        fields_keys.push_back(  fields_key{  arg<"a">( int( n % 1000 ) ),  arg<"x">( 0.5 * double( n ) )  }  );
+    }
+
+
+    run_all(  "flat map,  padding-free key (byte hash)",     "unordered_map,  padding-free key (byte hash)",  bytes_keys   );
+    run_all(  "flat map,  key with double (field hash)",     "unordered_map,  key with double (field hash)",  fields_keys  );
+}
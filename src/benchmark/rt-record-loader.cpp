@@ -0,0 +1,122 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Runtime benchmark:  throughput of record_loader on a generated CSV file.
+//
+//  -DTRIVIUM_BENCH_MB=<n>   size of the generated file in MB (default: 1024)
+
+
+#include "lt/record_loader.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+
+#ifndef TRIVIUM_BENCH_MB
+#define TRIVIUM_BENCH_MB 1024
+#endif
+
+
+using lt::operator""_text;
+using lt::operator""_index;
+
+using lt::entry;
+
+
+
+using columns_t  =  lt::record_columns<  entry< "id", long >
+                                      ,  entry< "price", double >
+                                      ,  entry< "qty", int >
+                                      ,  entry< "flag", bool >
+                                      >;
+
+
+
+constexpr std::size_t  file_size   =  std::size_t( TRIVIUM_BENCH_MB ) << 20;
+constexpr std::size_t  chunk_size  =  std::size_t( 1 ) << 20;
+
+
+
+int main()
+{
+    std::FILE* file = std::tmpfile();
+
+    if ( file == nullptr )
+        return 1;
+
+
+    std::size_t written = std::fprintf(  file,  "id,name,price,qty,flag\n"  );
+
+    for ( long n = 0;  written < file_size;  ++n )
+        written += std::fprintf(  file,  "%ld,item%ld,%ld.%02ld,%ld,%d\n",  n,  n % 977,  n % 10000,  n % 100,  n % 1000,  int( n % 2 )  );
+
+    std::rewind( file );
+
+
+    lt::record_loader< columns_t >  loader;
+    columns_t                       columns;
+    std::vector< char >             buffer( 2 * chunk_size );
+
+    columns.reserve( chunk_size / 16 );
+
+    double checksum = 0;
+
+
+    auto const start = std::chrono::steady_clock::now();
+
+    std::size_t  pending  =  0;
+    bool         header   =  true;
+
+    for ( ;; )
+    {
+        std::size_t const n     =  std::fread(  buffer.data() + pending,  1,  chunk_size,  file  );
+        bool        const last  =  n == 0;
+
+        std::string_view chunk(  buffer.data(),  pending + n  );
+
+        if ( header )
+        {
+            auto const end = chunk.find( '\n' );
+
+            loader.read_header(  chunk.substr( 0, end )  );
+            chunk.remove_prefix( end + 1 );
+            header = false;
+        }
+
+        std::size_t const consumed = loader.load(  chunk,  columns,  last  );
+
+        for ( double price : columns.column( "price"_index ) )
+            checksum += price;
+
+        columns.clear();
+
+        pending = chunk.size() - consumed;
+        std::memmove(  buffer.data(),  chunk.data() + consumed,  pending  );
+
+        if ( last )
+            break;
+    }
+
+    auto const stop = std::chrono::steady_clock::now();
+
+    std::fclose( file );
+
+
+    double const seconds = std::chrono::duration< double >( stop - start ).count();
+
+    std::printf(  "record_loader:  %zu rows,  %zu errors,  %.1f MB/s  (checksum %g)\n"
+               ,  loader.rows()
+               ,  loader.errors()
+               ,  double( written ) / ( 1 << 20 ) / seconds
+               ,  checksum
+               );
+
+    return loader.errors() == 0 ? 0 : 1;
+}
@@ -0,0 +1,85 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Runtime benchmark:  200k synthetic log lines are searched for error lines, once with
+//  lt::lib::regex (compile-time DFA) and once with std::regex (ECMAScript, regex_search).
+//  Reported are the throughput in MB/s and the number of matching lines.
+
+
+#include "lt/lib/regex.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <regex>
+#include <string>
+#include <vector>
+
+
+#define TRIVIUM_PATTERN  "(ERROR|WARN) \\[[a-z]+\\] (disk|net)[0-9]+ "
+
+
+
+template<  typename Search  >
+void run(  char const*  name,  std::vector< std::string > const&  lines,  Search  search  )
+{
+    std::size_t bytes = 0;
+
+    for ( auto const& l : lines )
+        bytes += l.size();
+
+
+    auto const start = std::chrono::steady_clock::now();
+
+    std::size_t n = 0;
+
+    for ( auto const& l : lines )
+        n += search( l );
+
+    std::chrono::duration< double > const t = std::chrono::steady_clock::now() - start;
+
+
+    std::printf(  "%-12s  %8.1f ms  %8.1f MB/s  (%zu lines)\n",  name,  t.count() * 1e3,  bytes / t.count() / 1e6,  n  );
+}
+
+
+
+int main()
+{
+    char const* const  levels[]   =  {  "INFO",  "DEBUG",  "WARN",  "ERROR"  };
+    char const* const  modules[]  =  {  "io",  "link",  "sched",  "db"  };
+    char const* const  devices[]  =  {  "disk",  "net",  "cpu",  "mem"  };
+
+    std::vector< std::string >  lines;
+
+    unsigned x = 1;
+
+    for ( int k = 0;  k != 200'000;  ++k )
+    {
+        x = x * 1103515245u + 12345u;
+
+        char line[ 160 ];
+
+        std::snprintf(  line,  sizeof( line )
+                     ,  "2024-03-01 12:%02u:%02u.%03u %s [%s] %s%u request %u took %u us"
+                     ,  x % 60,  ( x >> 6 ) % 60,  ( x >> 12 ) % 1000
+                     ,  levels[ ( x >> 16 ) % 4 ],  modules[ ( x >> 18 ) % 4 ],  devices[ ( x >> 20 ) % 4 ],  ( x >> 22 ) % 16
+                     ,  ( x >> 8 ) % 100000,  ( x >> 4 ) % 5000
+                     );
+
+        lines.emplace_back( line );
+    }
+
+
+    using pattern  =  lt::lib::regex< TRIVIUM_PATTERN >;
+
+    std::regex const  std_pattern(  TRIVIUM_PATTERN,  std::regex::optimize  );
+
+
+    run(  "lt::regex",   lines,  []( std::string const& l ) {  return pattern::search( l );  }  );
+    run(  "std::regex",  lines,  [&]( std::string const& l ) {  return std::regex_search(  l,  std_pattern  );  }  );
+}
@@ -0,0 +1,50 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//  import lt.eval;  is a replacement for  #include "lt/eval.hpp".
+
+
+module;
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+
+export module lt.eval;
+
+
+
+//  s_expr.hpp defines the member class s<>::parser,  which is not at namespace scope and
+//  cannot be exported itself;  it is reachable through the exported class s<>.
+
+export extern "C++"
+{
+#include "lt/s_types.hpp"
+}
+
+
+
+extern "C++"
+{
+#include "lt/s_expr.hpp"
+}
+
+
+
+export extern "C++"
+{
+#include "lt/eval.hpp"
+}
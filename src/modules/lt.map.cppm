@@ -0,0 +1,20 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//  import lt.map;  is a replacement for  #include "lt/map.hpp".
+
+
+export module lt.map;
+
+
+
+export extern "C++"
+{
+#include "lt/map.hpp"
+}
@@ -0,0 +1,39 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//  import lt.record;  is a replacement for  #include "lt/record.hpp".
+
+
+module;
+
+#include <array>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+
+
+export module lt.record;
+
+
+
+//  <cassert> has no include guard:  record.hpp includes it once more in the purview,  which
+//  only redefines assert (the declarations are in the global module fragment above).
+
+#ifdef __clang__
+#pragma clang diagnostic ignored "-Winclude-angled-in-module-purview"
+#endif
+
+export extern "C++"
+{
+#include "lt/record.hpp"
+}
@@ -0,0 +1,26 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//  import lt.text;  is a replacement for  #include "lt/text.hpp".
+
+
+module;
+
+#include <string_view>
+
+
+
+export module lt.text;
+
+
+
+export extern "C++"
+{
+#include "lt/text.hpp"
+}
@@ -0,0 +1,28 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+//  import lt.type_system;  is a replacement for  #include "lt/type_system.hpp".
+
+
+module;
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+
+
+export module lt.type_system;
+
+
+
+export extern "C++"
+{
+#include "lt/type_system.hpp"
+}
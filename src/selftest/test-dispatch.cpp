@@ -0,0 +1,111 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+//  #define TRIVIUM_CHECK_IS_DYNAMIC
+#include "lt/selftest/selftest.hpp"
+
+#include "lt/dispatch.hpp"
+#include "lt/eval.hpp"
+
+#include <cstddef>
+
+
+
+// -----------------------------------------------------------------------------
+//
+// Dispatch over types:
+//
+// -----------------------------------------------------------------------------
+
+
+struct circle     {  static constexpr int corners = 0;  };
+struct triangle   {  static constexpr int corners = 3;  };
+struct rectangle  {  static constexpr int corners = 4;  };
+
+
+
+TEST_CASE("dispatch over types")
+{
+    using shapes  =  lt::metaprogram<  "[x y z] ( list z x y )",  circle,  triangle,  rectangle  >;
+    using table   =  lt::dispatch_table< shapes >;
+
+    static_assert(  table::size == 3  );
+
+    auto const corners  =  []< typename T >(  lt::type_hull< T >,  int n  ) {  return n * T::corners;  };
+
+    CHECK(  table::visit( 0,  corners,  2 ) == 8  );
+    CHECK(  table::visit( 1,  corners,  2 ) == 0  );
+    CHECK(  table::visit( 2,  corners,  2 ) == 6  );
+
+    static_assert(  table::visit( 0,  corners,  1 ) == 4  );
+
+
+    int count = 0;
+
+    auto const increment  =  [&]< typename T >(  lt::type_hull< T >,  int& k  ) {  k += T::corners;  ++count;  };
+
+    int sum = 0;
+
+    for ( std::size_t i = 0;  i != table::size;  ++i )
+        table::visit(  i,  increment,  sum  );
+
+    CHECK(  sum == 7  );
+    CHECK(  count == 3  );
+}
+
+
+
+// -----------------------------------------------------------------------------
+//
+// Dispatch over values:
+//
+// -----------------------------------------------------------------------------
+
+
+TEST_CASE("dispatch over values")
+{
+    auto const twice  =  []< auto x >(  lt::v< x >  ) {  return 2 * x;  };
+
+
+    using dense  =  lt::dispatch_table<  lt::eval< "( list 3 1 7 5 )" >  >;
+
+    static_assert(  dense::visit( 2,  twice ) == 14  );
+
+    static_assert(  dense::index_of( 3 ) == 0  );
+    static_assert(  dense::index_of( 1 ) == 1  );
+    static_assert(  dense::index_of( 7 ) == 2  );
+    static_assert(  dense::index_of( 5 ) == 3  );
+    static_assert(  dense::index_of( 4 ) == dense::size  );
+    static_assert(  dense::index_of( -1 ) == dense::size  );
+    static_assert(  dense::index_of( 100 ) == dense::size  );
+
+    CHECK(  dense::visit_key( 5,  twice ) == 10  );
+
+
+    using sparse  =  lt::dispatch_table<  lt::eval< "( list 1000 -5 77 )" >  >;
+
+    static_assert(  sparse::index_of( 1000 ) == 0  );
+    static_assert(  sparse::index_of( -5 ) == 1  );
+    static_assert(  sparse::index_of( 77 ) == 2  );
+    static_assert(  sparse::index_of( 78 ) == sparse::size  );
+
+    CHECK(  sparse::visit_key( 77,  twice ) == 154  );
+
+
+    auto const unknown  =  []() {  return -1;  };
+
+    static_assert(  sparse::visit_key_or( 77,  twice,  unknown ) == 154  );
+    static_assert(  sparse::visit_key_or( 78,  twice,  unknown ) == -1  );
+
+    CHECK(  dense::visit_key_or( 4,  twice,  unknown ) == -1  );
+    CHECK(  dense::visit_key_or( 1000,  twice,  unknown ) == -1  );
+    CHECK(  dense::visit_key_or( 3,  twice,  unknown ) == 6  );
+}
@@ -0,0 +1,68 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+//  #define TRIVIUM_CHECK_IS_DYNAMIC
+#include "lt/selftest/selftest.hpp"
+
+
+//  The evaluation errors keep their operands and the enclosing expressions
+//  (test-eval.cpp checks the errors without TRIVIUM_FULL_EVAL_ERRORS):
+
+#define TRIVIUM_FULL_EVAL_ERRORS
+#include "lt/eval.hpp"
+
+
+
+//  error_parameters_< debug_output< eval_error< Kind, Operand... > > >:
+
+template<  typename  >
+struct error_parameters_;
+
+
+
+template<  template<  typename...  > class Error,  typename Kind,  typename... Operand  >
+struct error_parameters_<  lt::debug_output<  Error<  Kind,  Operand...  >  >  >
+{
+    using kind = Kind;
+
+    enum { operands = sizeof...(Operand) };
+};
+
+
+
+TEST_CASE("full evaluation errors")
+{
+    using expr_1 = lt::eval<"(show_error ( first 3 ))">;
+
+    lt::selftest::check_expression_equality<  error_parameters_< expr_1 >::kind,  lt::text< 'f', 'i', 'r', 's', 't' >  >();
+    TRIVIUM_CHECK(  error_parameters_< expr_1 >::operands == 1  );
+
+
+    using expr_2 = lt::eval<"(show_error ( first 4 ))">;
+
+    lt::selftest::check_expression_inequality<  expr_1,  expr_2  >();
+
+
+    //  an error in an argument is wrapped into the operation:
+
+    using expr_3 = lt::eval<"(show_error ( + 1 ( first 3 ) ))">;
+
+    lt::selftest::check_expression_equality<  error_parameters_< expr_3 >::kind,  lt::text< '+' >  >();
+    TRIVIUM_CHECK(  error_parameters_< expr_3 >::operands == 2  );
+
+
+    //  an error in the head of an application is wrapped into the application:
+
+    using expr_4 = lt::eval<"(show_error ( ( first 3 ) 2 ))">;
+
+    lt::selftest::check_expression_equality<  lt::debug_output<  error_parameters_< expr_4 >::kind  >,  expr_1  >();
+    TRIVIUM_CHECK(  error_parameters_< expr_4 >::operands == 1  );
+}
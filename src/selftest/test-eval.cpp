@@ -382,6 +382,29 @@ TEST_CASE("arithmetics")
     using Expr_6  =  lt::eval< "2" >;
 
     lt::selftest::check_expression_equality<  expr_6,  Expr_6  >();
+
+
+
+    // 64-bit and unsigned integers,  overflow checks and wrapping arithmetic:
+    using expr_7  =  lt::eval< "( list ( + 1u 2u )  ( * 3000000000ll 3 )  ( wrap_+ 0xffffffffu 1u )  ( wrap_- 0ull 1ull )"
+                               "       ( wrap_* 2147483647 2 )  ( eval_success ( + 0xffffffffu 1u ) )"
+                               "       ( eval_success ( - 0u 1u ) )  ( eval_success ( * 2147483647 2 ) ) )" >;
+    using Expr_7  =  lt::s<  lt::value< 3u >,  lt::value< 9000000000ll >,  lt::value< 0u >,  lt::value< ~0ull >
+                          ,  lt::integer< -2 >,  lt::value< false >,  lt::value< false >,  lt::value< false >
+                          >;
+
+    lt::selftest::check_expression_equality<  expr_7,  Expr_7  >("expr_7: ");
+
+
+
+    // bitwise operators:
+    using expr_8  =  lt::eval< "( list ( & 12 10 )  ( | 12 10 )  ( ^ 12 10 )  ( << 1ull 40 )  ( >> -16 2 )  ( ~ 0u )"
+                               "       ( eval_success ( << 1 32 ) )  ( eval_success ( ~ 'a ) ) )" >;
+    using Expr_8  =  lt::s<  lt::integer< 8 >,  lt::integer< 14 >,  lt::integer< 6 >,  lt::value< ( 1ull << 40 ) >
+                          ,  lt::integer< -4 >,  lt::value< ~0u >,  lt::value< false >,  lt::value< false >
+                          >;
+
+    lt::selftest::check_expression_equality<  expr_8,  Expr_8  >("expr_8: ");
 }
 
 
@@ -505,6 +528,26 @@ TEST_CASE("Stein's gcd")
 
 
 
+//  error_parameters< debug_output< eval_error< p... > > >  is  s< p... >:
+
+template<  typename  >
+struct error_parameters_;
+
+
+
+template<  template<  typename...  > class Error,  typename... p  >
+struct error_parameters_<  lt::debug_output<  Error< p... >  >  >
+{
+    using type = lt::s<  p...  >;
+};
+
+
+
+template<  typename Debug_Output  >
+using error_parameters = typename error_parameters_<  Debug_Output  >::type;
+
+
+
 TEST_CASE("evaluation errors")
 {
     std::cout << std::endl;
@@ -538,6 +581,23 @@ TEST_CASE("evaluation errors")
 
     lt::selftest::check_expression_equality<  expr_4,  Expr_4  >();
 
+
+    //  Without TRIVIUM_FULL_EVAL_ERRORS an error is  eval_error< kind >,  and an error in an
+    //  argument or in the head of an application is propagated unwrapped
+    //  (test-eval-full-errors.cpp checks the errors with TRIVIUM_FULL_EVAL_ERRORS):
+
+    using expr_5 = error_parameters<  lt::eval<"(show_error ( first 3 ))">  >;
+    using Expr_5 = lt::s<  lt::text< 'f', 'i', 'r', 's', 't' >  >;
+
+    lt::selftest::check_expression_equality<  expr_5,  Expr_5  >();
+
+
+    using expr_6 = lt::eval<"(show_error ( + 1 ( first 3 ) ))">;
+    using expr_7 = lt::eval<"(show_error ( ( first 3 ) 2 ))">;
+    using Expr_6 = lt::eval<"(show_error ( first 3 ))">;
+
+    lt::selftest::check_expression_equality<  expr_6,  Expr_6  >();
+    lt::selftest::check_expression_equality<  expr_7,  Expr_6  >();
 }
 
 
@@ -584,6 +644,224 @@ R"(
 
 
 
+TEST_CASE("match")
+{
+    using expr_1  =  lt::eval< "( import ( match '( * ?T ) '( * int ) )  T )" >;
+    using Expr_1  =  lt::text< 'i', 'n', 't' >;
+
+    lt::selftest::check_expression_equality<  expr_1,  Expr_1  >("expr_1: ");
+
+
+
+    using expr_2  =  lt::eval< "( import ( match '( f ?x ?rest... ) '( f 1 2 3 ) )  ( list x rest ) )" >;
+    using Expr_2  =  lt::eval< "'( 1 ( 2 3 ) )" >;
+
+    lt::selftest::check_expression_equality<  expr_2,  Expr_2  >("expr_2: ");
+
+
+
+    using expr_3  =  lt::eval< "( import ( match '( f ?x ?rest... ) '( f 1 ) )  rest )" >;
+    using Expr_3  =  lt::s<>;
+
+    lt::selftest::check_expression_equality<  expr_3,  Expr_3  >("expr_3: ");
+
+
+
+    // anonymous holes and nested patterns:
+    using expr_4  =  lt::eval< "( import ( match '( (?a ?) (b ?...) ?c ) '( (1 2) (b 3 4 5) (6) ) )  ( list a c ) )" >;
+    using Expr_4  =  lt::eval< "'( 1 ( 6 ) )" >;
+
+    lt::selftest::check_expression_equality<  expr_4,  Expr_4  >("expr_4: ");
+
+
+
+    // failures:
+    using expr_5  =  lt::eval< "( list ( eval_success ( match '( f ?x ) '( g 1 ) ) )"
+                               "       ( eval_success ( match '( f ?x ?rest... ) '( f ) ) )"
+                               "       ( eval_success ( match '( ?x ?x ) '( 1 1 ) ) )"
+                               "       ( eval_success ( match '( f ?x ) 'f ) ) )" >;
+
+    using Expr_5  =  lt::s<  lt::value<false>,  lt::value<false>,  lt::value<false>,  lt::value<false>  >;
+
+    lt::selftest::check_expression_equality<  expr_5,  Expr_5  >("expr_5: ");
+
+
+
+    // dispatch:
+    using expr_6  =
+    lt::eval<
+    R"(
+        ( def 'classify [x]
+              (  if_possible ( import ( match '( & ?T ) x )  ( list 'reference T ) )
+              (  if_possible ( import ( match '( * ?T ) x )  ( list 'pointer T ) )
+                             'other
+              ))
+
+          ( list ( classify '( * int ) )  ( classify '( & char ) )  ( classify 'double ) )
+        )
+    )" >;
+
+    using Expr_6  =  lt::eval< "'( ( pointer int ) ( reference char ) other )" >;
+
+    lt::selftest::check_expression_equality<  expr_6,  Expr_6  >("expr_6: ");
+
+
+
+    // partial application:
+    using expr_7  =  lt::eval< "( import ( ( match '( ?a ?b ) ) '( 1 2 ) )  ( + a b ) )" >;
+    using Expr_7  =  lt::value<3>;
+
+    lt::selftest::check_expression_equality<  expr_7,  Expr_7  >("expr_7: ");
+
+
+
+    // a rest hole before the end of a list is an error of the pattern:
+    using expr_8  =  lt::eval< "( list ( eval_success ( match '( ?xs... 1 ) '( 2 1 ) ) )"
+                               "       ( eval_success ( match '( f ( ?xs... b ) ) '( f ( a b ) ) ) )"
+                               "       ( eval_success ( match '( f ?xs... ) '( f 2 1 ) ) ) )" >;
+
+    using Expr_8  =  lt::s<  lt::value<false>,  lt::value<false>,  lt::value<true>  >;
+
+    lt::selftest::check_expression_equality<  expr_8,  Expr_8  >("expr_8: ");
+}
+
+
+
+
+TEST_CASE("text")
+{
+    using expr_1  =  lt::eval< "( list ( text_concat 'get_ 'name )  ( text_substr 'identifier 2 5 )  ( text_length 'identifier ) )" >;
+    using Expr_1  =  lt::eval< "'( get_name ent 10 )" >;
+
+    lt::selftest::check_expression_equality<  expr_1,  Expr_1  >("expr_1: ");
+
+
+
+    // empty text:
+    using expr_2  =  lt::eval< "( list ( text_length ( text_substr 'abc 1 1 ) )  ( text_concat 'abc ( text_substr 'abc 3 3 ) ) )" >;
+    using Expr_2  =  lt::eval< "'( 0 abc )" >;
+
+    lt::selftest::check_expression_equality<  expr_2,  Expr_2  >("expr_2: ");
+
+
+
+    // lexicographic order:
+    using expr_3  =  lt::eval< "( list ( text_< 'abc 'abd )  ( text_< 'abd 'abc )  ( text_< 'ab 'abc )  ( text_< 'abc 'abc ) )" >;
+    using Expr_3  =  lt::s<  lt::value<true>,  lt::value<false>,  lt::value<true>,  lt::value<false>  >;
+
+    lt::selftest::check_expression_equality<  expr_3,  Expr_3  >("expr_3: ");
+
+
+
+    // FNV-1a( "abc" ) = 0x1a47e90b:
+    using expr_4  =  lt::eval< "( list ( text_hash 'abc )  ( == ( text_hash 'abc ) ( text_hash ( text_concat 'a 'bc ) ) ) )" >;
+    using Expr_4  =  lt::s<  lt::integer< 0x1a47e90b >,  lt::value<true>  >;
+
+    lt::selftest::check_expression_equality<  expr_4,  Expr_4  >("expr_4: ");
+
+
+
+    // failures and partial application:
+    using expr_5  =  lt::eval< "( list ( eval_success ( text_substr 'abc 2 4 ) )"
+                               "       ( eval_success ( text_substr 'abc 2 1 ) )"
+                               "       ( eval_success ( text_length 3 ) )"
+                               "       ( ( text_concat 'key_ ) 'x ) )" >;
+
+    using Expr_5  =  lt::eval< "'( false false false key_x )" >;
+
+    lt::selftest::check_expression_equality<  expr_5,  Expr_5  >("expr_5: ");
+}
+
+
+
+
+TEST_CASE("packed lists")
+{
+    using expr_1  =  lt::eval< "#( 1 -2 0x10 010 0b11 )" >;
+
+    lt::selftest::check_expression_equality<  expr_1,  lt::packed< 1, -2, 16, 8, 3 >  >("expr_1: ");
+    lt::selftest::check_expression_equality<  lt::eval< "#( )" >,  lt::s<>  >("empty: ");
+
+
+
+    using expr_2  =  lt::eval< "( list ( first #( 4 5 6 ) )  ( count #( 4 5 6 ) )  ( drop_first #( 4 5 6 ) )  ( drop_first #( 4 ) ) )" >;
+    using Expr_2  =  lt::s<  lt::integer<4>,  lt::integer<3>,  lt::packed< 5, 6 >,  lt::s<>  >;
+
+    lt::selftest::check_expression_equality<  expr_2,  Expr_2  >("expr_2: ");
+
+
+
+    using expr_3  =  lt::eval< "( list ( cons 3 #( 4 5 ) )  ( rcons 3 #( 4 5 ) )  ( cons 'a #( 4 ) ) )" >;
+    using Expr_3  =  lt::s<  lt::packed< 3, 4, 5 >,  lt::packed< 4, 5, 3 >,  lt::eval< "'( a 4 )" >  >;
+
+    lt::selftest::check_expression_equality<  expr_3,  Expr_3  >("expr_3: ");
+
+
+
+    // comparison with unpacked lists and conversions:
+    using expr_4  =  lt::eval< "( list ( eq #( 4 5 ) '( 4 5 ) )  ( eq '( 4 6 ) #( 4 5 ) )  ( eq ( drop_first #( 4 ) ) () )"
+                               "       ( eq ( pack '( 4 5 ) ) #( 4 5 ) )  ( eq ( unpack #( 4 5 ) ) '( 4 5 ) )"
+                               "       ( eval_success ( pack '( 1 true ) ) )  ( is_atom #( 1 ) ) )" >;
+    using Expr_4  =  lt::eval< "'( true false true true true false false )" >;
+
+    lt::selftest::check_expression_equality<  expr_4,  Expr_4  >("expr_4: ");
+    lt::selftest::check_expression_equality<  lt::eval< "( unpack #( 4 5 ) )" >,  lt::s<  lt::integer<4>,  lt::integer<5>  >  >("unpack: ");
+
+
+
+    // folds:
+    using expr_5  =  lt::eval< "( list ( fold + 0 #( 1 2 3 4 ) )  ( fold - 0 #( 1 2 3 4 ) )  ( fold * 1 '( 1 2 3 4 ) )"
+                               "       ( fold [acc x] ( + acc ( * x x ) ) 0 #( 1 2 3 ) )"
+                               "       ( eval_success ( fold / 1 #( 1 0 ) ) ) )" >;
+    using Expr_5  =  lt::eval< "'( 10 -10 24 14 false )" >;
+
+    lt::selftest::check_expression_equality<  expr_5,  Expr_5  >("expr_5: ");
+
+
+
+    // packed lists from C++:
+    using expr_6  =  lt::metaprogram< "[xs]( fold + ( first xs ) ( drop_first xs ) )",  lt::packed< 1, 2, 3 >  >;
+
+    lt::selftest::check_expression_equality<  expr_6,  lt::integer<6>  >("expr_6: ");
+}
+
+
+
+TEST_CASE("pure integer definitions")
+{
+    using expr_1  =  lt::eval<
+    R"({
+            ( def 'fac  [n]    ( if ( == n 0 ) 1 ( * n ( fac ( - n 1 ) ) ) ) )
+            ( def 'gcd  [x y]  ( if ( == y 0 ) x ( gcd y ( % x y ) ) ) )
+            ( def 'even [x]    ( == 0 ( % x 2 ) ) )
+
+            ( list ( fac 10 )  ( gcd 84 36 )  ( ( gcd 84 ) 36 )  ( even 10 )  ( even ( fac 3 ) ) )
+        }
+    )" >;
+
+    using Expr_1  =  lt::s<  lt::integer< 3628800 >,  lt::integer<12>,  lt::integer<12>,  lt::value<true>,  lt::value<true>  >;
+
+    lt::selftest::check_expression_equality<  expr_1,  Expr_1  >("expr_1: ");
+
+
+
+    // arguments that are no int or bool values and failing reductions fall back to the Y-combinator:
+    using expr_2  =  lt::eval<
+    R"({
+            ( def 'fac    [n]    ( if ( == n 0 ) 1 ( * n ( fac ( - n 1 ) ) ) ) )
+            ( def 'second [x y]  y )
+
+            ( list ( second 1 '( a b ) )  ( eval_success ( fac 13 ) )  ( eval_success ( fac 'a ) ) )
+        }
+    )" >;
+
+    using Expr_2  =  lt::eval< "'( ( a b ) false false )" >;
+
+    lt::selftest::check_expression_equality<  expr_2,  Expr_2  >("expr_2: ");
+}
+
+
+
 #ifndef __clang__   // non-templates arguments of type double are not supported in Clang 16
 #ifndef _MSC_VER    // msvc does not like this test.
 
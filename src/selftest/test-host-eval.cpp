@@ -0,0 +1,252 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include "lt/selftest/selftest.hpp"
+
+
+#include "lt/host_eval.hpp"
+
+#include <string>
+
+
+//  The host-side interpreter has to agree with lt::eval:  the expected types below are
+//  the ones of the corresponding compile-time tests in test-eval.cpp and test-parser.cpp.
+
+
+
+static std::string eval(  std::string_view  src  )
+{
+    return lt::host::cpp_type(  lt::host::evaluate( src ),  true  );
+}
+
+
+
+static std::string same_as(  std::string_view  src  )
+{
+    return eval( src );
+}
+
+
+
+static bool ill_formed(  std::string_view  src  )
+{
+    try
+    {
+        lt::host::evaluate( src );
+    }
+    catch ( lt::host::error const& )
+    {
+        return true;
+    }
+
+    return false;
+}
+
+
+
+// -----------------------------------------------------------------------------
+//
+// Lexer and literals:
+//
+// -----------------------------------------------------------------------------
+
+
+TEST_CASE("literals")
+{
+    CHECK(  eval( "( list 0 -0 +12 0x1f 0XfF 010 0b101 true false )" )
+            ==  "lt::s< lt::value< 0 >, lt::value< 0 >, lt::value< 12 >, lt::value< 31 >, lt::value< 255 >"
+                ", lt::value< 8 >, lt::value< 5 >, lt::value< true >, lt::value< false > >"  );
+
+    CHECK(  eval( "( list 7u 0xffffffffU -5ll 9223372036854775807LL -9223372036854775808ll 1ull )" )
+            ==  "lt::s< lt::value< 7u >, lt::value< 4294967295u >, lt::value< -5ll >, lt::value< 9223372036854775807ll >"
+                ", lt::value< ( -9223372036854775807ll - 1 ) >, lt::value< 1ull > >"  );
+
+    CHECK(  eval( "#( 1 -2 0x10 010 0b11 )" )  ==  "lt::packed< 1, -2, 16, 8, 3 >"  );
+    CHECK(  eval( "#( )" )  ==  "lt::s<>"  );
+
+    CHECK(  eval( "'a;comment\n" )   ==  "lt::text< 'a' >"  );
+    CHECK(  eval( "'+abc" )          ==  "lt::text< 'a', 'b', 'c' >"  );
+    CHECK(  eval( "'a\\'b" )         ==  "lt::text< 'a', '\\\\', '\\'', 'b' >"  );
+
+    CHECK(  ill_formed( "2147483648" )  );
+    CHECK(  ill_formed( "0x" )  );
+    CHECK(  ill_formed( "09" )  );
+    CHECK(  ill_formed( "-a" )  );
+    CHECK(  ill_formed( "4294967296u" )  );
+    CHECK(  ill_formed( "-1u" )  );
+    CHECK(  ill_formed( "#( 1 2" )  );
+    CHECK(  ill_formed( "#( 2147483648 )" )  );
+}
+
+
+
+TEST_CASE("parser")
+{
+    CHECK(  eval( "(quote ( first (list 1 2 3) ))" )
+            ==  "lt::s< lt::text< 'f', 'i', 'r', 's', 't' >, lt::s< lt::list< 3 >, lt::value< 1 >, lt::value< 2 >, lt::value< 3 > > >"  );
+
+    CHECK(  eval( "(quote (quote( quote 222)))" )  ==  "lt::quoted< lt::quoted< lt::value< 222 > > >"  );
+    CHECK(  eval( "'{ a b c d }" )  ==  same_as( "'( a ( b ( c d ) ) )" )  );
+    CHECK(  eval( "'{ a }" )  ==  "lt::s< lt::text< 'a' > >"  );
+    CHECK(  eval( "'[x] x" )  ==  "lt::s< lt::S, lt::K, lt::K >"  );
+    CHECK(  eval( "'[x] (f x)" )  ==  "lt::text< 'f' >"  );
+    CHECK(  eval( "'[x y] (f y x)" )  ==  "lt::s< lt::S, lt::s< lt::K, lt::s< lt::S, lt::text< 'f' > > >, lt::K >"  );
+
+    CHECK(  lt::host::cpp_type(  lt::host::program( "[x]'x" )  )  ==  "lt::s< lt::K, lt::quoted< lt::text< 'x' > > >"  );
+    CHECK(  lt::host::cpp_type(  lt::host::program( "(quote [x](* 2 x))" )  )  ==  "lt::quoted< lt::s< lt::text< '*' >, lt::value< 2 > > >"  );
+
+    CHECK(  ill_formed( "(list 1" )  );
+    CHECK(  ill_formed( "1 2" )  );
+    CHECK(  ill_formed( "[x] (f (g))" )  );
+    CHECK(  ill_formed( "[1] x" )  );
+}
+
+
+
+// -----------------------------------------------------------------------------
+//
+// The interpreter:
+//
+// -----------------------------------------------------------------------------
+
+
+TEST_CASE("lists")
+{
+    CHECK(  eval( "(list (list 1 2 3))" )  ==  "lt::s< lt::s< lt::value< 1 >, lt::value< 2 >, lt::value< 3 > > >"  );
+    CHECK(  eval( "(drop_first  (list 1 ( list 2 3)))" )  ==  "lt::s< lt::s< lt::value< 2 >, lt::value< 3 > > >"  );
+    CHECK(  eval( "((cons 1) (list 2 3 4))" )  ==  same_as( "'( 1 2 3 4 )" )  );
+    CHECK(  eval( "(rcons 1 (drop_first (list 2 3 4)))" )  ==  same_as( "'( 3 4 1 )" )  );
+    CHECK(  eval( "(count '(1 2 3))" )  ==  "lt::value< 3 >"  );
+    CHECK(  eval( "(eval_success (count 3))" )  ==  "lt::value< false >"  );
+    CHECK(  eval( "(apply 'first  (list (list 1 2 3 ) ) )" )  ==  "lt::value< 1 >"  );
+    CHECK(  eval( "(eval (eval (quote ( first ( list 1 2 3)))))" )  ==  "lt::value< 1 >"  );
+}
+
+
+
+TEST_CASE("lambda expressions and definitions")
+{
+    CHECK(  eval( "(  [x y z] (x (y z)) first drop_first (list 1 2 3)) " )  ==  "lt::value< 2 >"  );
+    CHECK(  eval( "( ([ x y z w ] w    1  2) 3  4 )" )  ==  "lt::value< 4 >"  );
+    CHECK(  eval( "([x] x [x] x)" )  ==  same_as( "[x] x" )  );
+    CHECK(  eval( "(if ([x] false  (quote ignored_input) ) 1 0 )" )  ==  "lt::value< 0 >"  );
+
+    CHECK(  eval( "( def 'f [n] ( if ( == n 0 ) 1 ( * n ( f ( - n 1 ) ) ) ) (f 6) )" )  ==  "lt::value< 720 >"  );
+    CHECK(  eval( "((def   'x  [y](* 2 y))  x { (def 'x 4) x }  )  " )  ==  "lt::value< 8 >"  );
+    CHECK(  eval( "( def 'y 2 (list y ( def 'x 3 x) ))" )  ==  same_as( "'( 2 3 )" )  );
+
+    CHECK(  eval( R"({
+                        ( def 'g [x y] ( * x y ) )
+                        ( def 'c 5 )
+                        ( def 'h [z] (g c z ) )
+                        (h 3)
+                     })" )
+            ==  "lt::value< 15 >"  );
+
+    CHECK(  eval( R"({
+                        ( def 'fac  [n]    ( if ( == n 0 ) 1 ( * n ( fac ( - n 1 ) ) ) ) )
+                        ( def 'gcd  [x y]  ( if ( == y 0 ) x ( gcd y ( % x y ) ) ) )
+                        ( list ( fac 10 )  ( gcd 84 36 )  ( ( gcd 84 ) 36 )  ( eval_success ( fac 13 ) ) )
+                     })" )
+            ==  "lt::s< lt::value< 3628800 >, lt::value< 12 >, lt::value< 12 >, lt::value< false > >"  );
+
+    //  the deep recursions of the compile-time interpreter are cheap on the host:
+    CHECK(  eval( "{ (def 'sum [k] (if (== k 0) 0 (+ k (sum (- k 1))))) (sum 500) }" )  ==  "lt::value< 125250 >"  );
+}
+
+
+
+TEST_CASE("arithmetics")
+{
+    CHECK(  eval( "( list ( + 1u 2u )  ( * 3000000000ll 3 )  ( wrap_+ 0xffffffffu 1u )  ( wrap_- 0ull 1ull )"
+                  "       ( wrap_* 2147483647 2 )  ( eval_success ( + 0xffffffffu 1u ) )"
+                  "       ( eval_success ( - 0u 1u ) )  ( eval_success ( * 2147483647 2 ) ) )" )
+            ==  "lt::s< lt::value< 3u >, lt::value< 9000000000ll >, lt::value< 0u >, lt::value< 18446744073709551615ull >"
+                ", lt::value< -2 >, lt::value< false >, lt::value< false >, lt::value< false > >"  );
+
+    CHECK(  eval( "( list ( & 12 10 )  ( | 12 10 )  ( ^ 12 10 )  ( << 1ull 40 )  ( >> -16 2 )  ( ~ 0u )"
+                  "       ( eval_success ( << 1 32 ) )  ( eval_success ( ~ 'a ) ) )" )
+            ==  "lt::s< lt::value< 8 >, lt::value< 14 >, lt::value< 6 >, lt::value< 1099511627776ull >"
+                ", lt::value< -4 >, lt::value< 4294967295u >, lt::value< false >, lt::value< false > >"  );
+
+    CHECK(  eval( "( list ( / -7 2 ) ( % -7 2 ) ( < -1 1u ) ( + true true ) ( eval_success ( / -2147483647 0 ) ) )" )
+            ==  "lt::s< lt::value< -3 >, lt::value< -1 >, lt::value< false >, lt::value< 2 >, lt::value< false > >"  );
+}
+
+
+
+TEST_CASE("lazy evaluation")
+{
+    CHECK(  eval( "(if true 1 undefined_string)" )  ==  "lt::value< 1 >"  );
+    CHECK(  eval( "(eval_success (humbug blabla (asdf)  ) )" )  ==  "lt::value< false >"  );
+    CHECK(  eval( "(if_possible humbug (list 1 2 3))" )  ==  same_as( "'( 1 2 3 )" )  );
+    CHECK(  eval( "(eval_success (if_possible humbug  also_humbug ))" )  ==  "lt::value< false >"  );
+}
+
+
+
+TEST_CASE("match and import")
+{
+    CHECK(  eval( "( import ( match '( f ?x ?rest... ) '( f 1 2 3 ) )  ( list x rest ) )" )  ==  same_as( "'( 1 ( 2 3 ) )" )  );
+    CHECK(  eval( "( import ( match '( (?a ?) (b ?...) ?c ) '( (1 2) (b 3 4 5) (6) ) )  ( list a c ) )" )  ==  same_as( "'( 1 ( 6 ) )" )  );
+    CHECK(  eval( "( import ( ( match '( ?a ?b ) ) '( 1 2 ) )  ( + a b ) )" )  ==  "lt::value< 3 >"  );
+
+    CHECK(  eval( "( list ( eval_success ( match '( f ?x ) '( g 1 ) ) )"
+                  "       ( eval_success ( match '( f ?x ?rest... ) '( f ) ) )"
+                  "       ( eval_success ( match '( ?x ?x ) '( 1 1 ) ) )"
+                  "       ( eval_success ( match '( f ?x ) 'f ) ) )" )
+            ==  same_as( "'( false false false false )" )  );
+
+    CHECK(  eval( "( list ( eval_success ( match '( ?xs... 1 ) '( 2 1 ) ) )"
+                  "       ( eval_success ( match '( f ( ?xs... b ) ) '( f ( a b ) ) ) )"
+                  "       ( eval_success ( match '( f ?xs... ) '( f 2 1 ) ) ) )" )
+            ==  same_as( "'( false false true )" )  );
+
+    CHECK(  eval( "{ (def 'x 1) (def 'y 2) (def 'x 3) export }" )
+            ==  "lt::i< lt::pair< lt::text< 'x' >, lt::value< 3 > >, lt::pair< lt::text< 'y' >, lt::value< 2 > > >"  );
+}
+
+
+
+TEST_CASE("text and packed lists")
+{
+    CHECK(  eval( "( list ( text_concat 'get_ 'name )  ( text_substr 'identifier 2 5 )  ( text_length 'identifier ) )" )
+            ==  same_as( "'( get_name ent 10 )" )  );
+
+    CHECK(  eval( "( list ( text_< 'abc 'abd )  ( text_< 'ab 'abc )  ( text_hash 'abc ) )" )
+            ==  "lt::s< lt::value< true >, lt::value< true >, lt::value< 440920331 > >"  );
+
+    CHECK(  eval( "( list ( first #( 4 5 6 ) )  ( count #( 4 5 6 ) )  ( drop_first #( 4 5 6 ) )  ( drop_first #( 4 ) ) )" )
+            ==  "lt::s< lt::value< 4 >, lt::value< 3 >, lt::packed< 5, 6 >, lt::s<> >"  );
+
+    CHECK(  eval( "( list ( cons 3 #( 4 5 ) )  ( rcons 3 #( 4 5 ) )  ( cons 'a #( 4 ) ) )" )
+            ==  "lt::s< lt::packed< 3, 4, 5 >, lt::packed< 4, 5, 3 >, lt::s< lt::text< 'a' >, lt::value< 4 > > >"  );
+
+    CHECK(  eval( "( list ( eq #( 4 5 ) '( 4 5 ) )  ( eq ( pack '( 4 5 ) ) #( 4 5 ) )  ( eval_success ( pack '( 1 true ) ) )  ( is_atom #( 1 ) ) )" )
+            ==  same_as( "'( true true false false )" )  );
+
+    CHECK(  eval( "( list ( fold + 0 #( 1 2 3 4 ) )  ( fold [acc x] ( + acc ( * x x ) ) 0 #( 1 2 3 ) )  ( eval_success ( fold / 1 #( 1 0 ) ) ) )" )
+            ==  same_as( "'( 10 14 false )" )  );
+}
+
+
+
+TEST_CASE("results")
+{
+    CHECK(  lt::host::cpp_type(  lt::host::evaluate( "(list 1 'a)" )  )  ==  "lt::s< lt::value< 1 >, lt::text< 'a' > >"  );
+    CHECK(  lt::host::cpp_type(  lt::host::evaluate( "(+ 1)" ),  true  )  ==  "lt::i<>::call< 1, lt::text< '+' >, lt::value< 1 > >"  );
+    CHECK(  lt::host::cpp_type(  lt::host::evaluate( "-2147483647" )  )  ==  "lt::value< -2147483647 >"  );
+
+    CHECK_THROWS_AS(  lt::host::cpp_type(  lt::host::evaluate( "(+ 1)" )  ),  lt::host::error  );
+    CHECK_THROWS_AS(  lt::host::cpp_type(  lt::host::evaluate( "(+ 1 'a)" )  ),  lt::host::error  );
+
+    CHECK(  lt::host::uses_eval_hpp(  lt::host::evaluate( "[x] x" )  )  );
+    CHECK(  ! lt::host::uses_eval_hpp(  lt::host::evaluate( "'( a #( 1 ) )" )  )  );
+}
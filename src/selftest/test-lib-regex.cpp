@@ -0,0 +1,103 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+//  #define TRIVIUM_CHECK_IS_DYNAMIC
+#include "lt/selftest/selftest.hpp"
+
+#include "lt/lib/regex.hpp"
+
+
+using lt::lib::regex;
+
+
+
+// -----------------------------------------------------------------------------
+//
+// Matching:  match is anchored at both ends, search is not.
+//
+// -----------------------------------------------------------------------------
+
+TEST_CASE("regex literals and operators")
+{
+    static_assert(  regex< "abc" >::match( "abc" )  );
+    static_assert(  ! regex< "abc" >::match( "abcd" )  );
+    static_assert(  ! regex< "abc" >::match( "ab" )  );
+    static_assert(  regex< "abc" >::search( "xxabcx" )  );
+    static_assert(  ! regex< "abc" >::search( "xxabx" )  );
+
+    static_assert(  regex< "" >::match( "" )  );
+    static_assert(  ! regex< "" >::match( "a" )  );
+    static_assert(  regex< "" >::search( "a" )  );
+
+    static_assert(  regex< "a(b|c)*d" >::match( "ad" )  );
+    static_assert(  regex< "a(b|c)*d" >::match( "abccbd" )  );
+    static_assert(  ! regex< "a(b|c)*d" >::match( "abxd" )  );
+
+    static_assert(  regex< "a?b+" >::match( "bbb" )  );
+    static_assert(  regex< "a?b+" >::match( "ab" )  );
+    static_assert(  ! regex< "a?b+" >::match( "a" )  );
+
+    static_assert(  regex< "x{2,3}" >::match( "xx" )  );
+    static_assert(  regex< "x{2,3}" >::match( "xxx" )  );
+    static_assert(  ! regex< "x{2,3}" >::match( "x" )  );
+    static_assert(  ! regex< "x{2,3}" >::match( "xxxx" )  );
+    static_assert(  regex< "(ab){2,}" >::match( "ababab" )  );
+    static_assert(  ! regex< "(ab){2,}" >::match( "ab" )  );
+    static_assert(  regex< "(a|b){0,1}c" >::match( "c" )  );
+    static_assert(  regex< "a+{2}" >::match( "aaa" )  );
+}
+
+
+
+TEST_CASE("regex character classes")
+{
+    static_assert(  regex< "[a-c]+" >::match( "abcabc" )  );
+    static_assert(  ! regex< "[a-c]+" >::match( "abd" )  );
+    static_assert(  regex< "[^0-9]*" >::match( "abc" )  );
+    static_assert(  ! regex< "[^0-9]*" >::match( "a1" )  );
+    static_assert(  regex< "[]a]+" >::match( "]a]" )  );
+    static_assert(  regex< "[a-]+" >::match( "-a" )  );
+
+    static_assert(  regex< "\\d{4}-\\d{2}-\\d{2}" >::match( "2024-01-31" )  );
+    static_assert(  ! regex< "\\d{4}-\\d{2}-\\d{2}" >::match( "2024-1-31" )  );
+    static_assert(  regex< "\\w+\\s\\W" >::match( "x_1 !" )  );
+    static_assert(  regex< "a\\.b" >::match( "a.b" )  );
+    static_assert(  ! regex< "a\\.b" >::match( "axb" )  );
+    static_assert(  regex< "a.b" >::match( "axb" )  );
+    static_assert(  ! regex< "a.b" >::match( "a\nb" )  );
+    static_assert(  regex< "[\\d_]+" >::match( "1_2" )  );
+}
+
+
+
+TEST_CASE("regex on log lines")
+{
+    using error_line  =  regex< "(ERROR|WARN) \\[[a-z]+\\] (disk|net)[0-9]+" >;
+
+    char const* const  lines[]  =
+    {
+        "2024-03-01 12:00:00 ERROR [io] disk7 failed",
+        "2024-03-01 12:00:01 INFO [io] disk7 ok",
+        "2024-03-01 12:00:02 WARN [link] net12 flapping",
+        "2024-03-01 12:00:03 WARN [link] net flapping",
+    };
+
+    CHECK(  error_line::search( lines[ 0 ] )  );
+    CHECK(  ! error_line::search( lines[ 1 ] )  );
+    CHECK(  error_line::search( lines[ 2 ] )  );
+    CHECK(  ! error_line::search( lines[ 3 ] )  );
+
+
+    //  the minimal DFA:  start, after a, after a(b|c)* and d, and the dead state
+
+    static_assert(  regex< "a(b|c)*d" >::states == 4  );
+    static_assert(  regex< "a(b|c)*d" >::classes == 4  );       //  a,  b c,  d,  other bytes
+}
@@ -340,3 +340,34 @@ TEST_CASE("lookup with fallback value")
     lt::selftest::check_expression_equality< c_2,  C_2 >();
     lt::selftest::check_expression_equality< c_3,  C_3 >();
 }
+
+
+
+template<  typename Table,  typename Key  >
+concept has_key  =  requires {  Table::index_of(  lt::type_hull< Key >{}  );  };
+
+
+
+TEST_CASE("key tables")
+{
+    using a = key_value_pair<  object<1>,  int  >;
+    using b = key_value_pair<  object<2>,  char  >;
+    using c = key_value_pair<  object<3>,  long  >;
+
+    using table = lt::key_table< a, b, c >;
+
+    static_assert(  table::index_of(  lt::type_hull< object<1> >{}  ) == 0  );
+    static_assert(  table::index_of(  lt::type_hull< object<3> >{}  ) == 2  );
+
+    lt::selftest::check_expression_equality<  table::type< object<2> >,  b  >();
+
+    static_assert(  has_key< table,  object<1> >  );
+    static_assert(  ! has_key< table,  object<4> >  );
+
+
+    static_assert(  lt::map_parameters< a, b, c >  );
+    static_assert(  lt::map_parameters<>  );
+    static_assert(  ! lt::map_parameters<  a,  b,  key_value_pair<  object<1>,  char  >  >  );
+    static_assert(  ! lt::map_parameters< a, a >  );
+    static_assert(  ! lt::map_parameters< int >  );
+}
@@ -104,6 +104,24 @@ TEST_CASE_TEMPLATE_APPLY( numbers_equal_test, integer_test_minus_123 );
 
 
 
+TEST_CASE("integer literals with type suffix")
+{
+    lt::selftest::check_expression_equality<  lt::s_expr<"123u">,                 lt::value< 123u >  >("123u: ");
+    lt::selftest::check_expression_equality<  lt::s_expr<"0xffffffffU">,          lt::value< 0xffffffffu >  >("0xffffffffU: ");
+    lt::selftest::check_expression_equality<  lt::s_expr<"-0173ll">,              lt::value< -123ll >  >("-0173ll: ");
+    lt::selftest::check_expression_equality<  lt::s_expr<"0b1111011LL">,          lt::value< 123ll >  >("0b1111011LL: ");
+    lt::selftest::check_expression_equality<  lt::s_expr<"0x9e3779b97f4a7c15ull">,  lt::value< 0x9e3779b97f4a7c15ull >  >("0x9e3779b97f4a7c15ull: ");
+
+    lt::selftest::check_expression_equality<  lt::s_expr<"-9223372036854775808ll">
+                                           ,  lt::value<  -9223372036854775807ll - 1  >
+                                           >("-9223372036854775808ll: ");
+
+    // no numbers:
+    lt::selftest::check_expression_equality<  lt::s_expr<"ull">,  lt::text<'u','l','l'>  >("ull: ");
+}
+
+
+
 // -----------------------------------------------------------------------------
 //
 // trailing whitespace
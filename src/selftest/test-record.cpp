@@ -0,0 +1,629 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+//  #define TRIVIUM_CHECK_IS_DYNAMIC
+#include "lt/selftest/selftest.hpp"
+
+
+#include "lt/concurrent_record.hpp"
+#include "lt/record.hpp"
+#include "lt/record_columns.hpp"
+#include "lt/record_hash.hpp"
+#include "lt/record_layout.hpp"
+#include "lt/record_loader.hpp"
+#include "lt/s_expr.hpp"
+#include "lt/tracked_record.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+
+using lt::operator""_text;
+using lt::operator""_index;
+
+
+using lt::entry;
+using lt::fixed_entry;
+using lt::arg;
+
+
+
+// -----------------------------------------------------------------------------
+//
+// Padding-minimizing layout:
+//
+// -----------------------------------------------------------------------------
+
+
+TEST_CASE("optimal_layout")
+{
+    using layout  =  lt::optimal_layout<  entry< "a", bool >
+                                       ,  entry< "b", double >
+                                       ,  entry< "c", int >
+                                       ,  entry< "d", bool >
+                                       >;
+
+    using Layout  =  lt::record<  entry< "b", double >
+                               ,  entry< "c", int >
+                               ,  entry< "a", bool >
+                               ,  entry< "d", bool >
+                               >;
+
+    lt::selftest::check_expression_equality<  layout,  Layout  >("layout: ");
+}
+
+
+
+TEST_CASE("packed_record")
+{
+    using plain   =  lt::record<  entry< "a", bool >,  entry< "b", double >,  entry< "c", int >,  entry< "d", bool >  >;
+    using packed  =  lt::packed_record<  entry< "a", bool >,  entry< "b", double >,  entry< "c", int >,  entry< "d", bool >  >;
+
+    static_assert(  sizeof(packed) == sizeof(double) + sizeof(int) + 2*sizeof(bool) + 2  );
+    static_assert(  sizeof(packed) <  sizeof(plain)  );
+
+
+    packed p{  arg<"a">( true ),  arg<"b">( 2.5 ),  arg<"c">( 7 ),  arg<"d">( false )  };
+
+    CHECK(  p["b"_index] == 2.5  );
+    CHECK(  p["c"_index] == 7  );
+
+
+    auto declared_order  =  []( bool a,  double b,  int c,  bool d ) {  return a && b == 2.5 && c == 7 && !d;  };
+
+    CHECK(  p.invoke( declared_order )  );
+    CHECK(  p.constant().invoke( declared_order )  );
+
+
+    plain r;
+    r <<= p;
+
+    CHECK(  r.invoke( declared_order )  );
+
+
+    packed q;
+    q <<= r;
+
+    CHECK(  q.invoke( declared_order )  );
+
+
+    using with_fixed_entry  =  lt::packed_record<  entry< "a", bool >,  fixed_entry< "e", int >,  entry< "b", double >  >;
+
+    CHECK(  with_fixed_entry{}.invoke(  []( bool a,  int e,  double b ) {  return !a && e == 0 && b == 0;  } )  );
+}
+
+
+
+// -----------------------------------------------------------------------------
+//
+// Structure of arrays:
+//
+// -----------------------------------------------------------------------------
+
+
+TEST_CASE("record_columns")
+{
+    using row_t      =  lt::record<  entry< "a", bool >,  entry< "b", double >,  fixed_entry< "e", int >,  entry< "c", int >  >;
+    using columns_t  =  lt::record_columns<  entry< "a", bool >,  entry< "b", double >,  fixed_entry< "e", int >,  entry< "c", int >  >;
+
+
+    columns_t columns;
+    columns.reserve( 10 );
+
+    for ( int k = 0;  k != 10;  ++k )
+        columns.push_back(  row_t{  arg<"a">( k % 2 == 0 ),  arg<"b">( 0.5 * k ),  arg<"c">( k )  }  );
+
+    CHECK(  columns.size() == 10  );
+
+
+    double sum = 0;
+
+    for ( double b : columns.column( "b"_index ) )
+        sum += b;
+
+    CHECK(  sum == 22.5  );
+    CHECK(  columns.column( "a"_index ).size() == 10  );
+
+
+    columns[ 3 ][ "c"_index ] = 42;
+
+    CHECK(  columns.column( "c"_index )[ 3 ] == 42  );
+    CHECK(  columns[ 3 ][ "e"_index ] == 0  );
+
+
+    row_t row = columns[ 4 ];
+
+    CHECK(  row.invoke(  []( bool a,  double b,  int e,  int c ) {  return a && b == 2 && e == 0 && c == 4;  } )  );
+
+
+    columns_t const copy = columns;
+
+    CHECK(  copy.size() == 10  );
+    CHECK(  copy[ 3 ].invoke(  []( bool a,  double b,  int,  int c ) {  return !a && b == 1.5 && c == 42;  } )  );
+}
+
+
+
+TEST_CASE("record_columns growth")
+{
+    struct no_default
+    {
+        explicit no_default(  int x  )  :  x( x )  { }
+
+        int x;
+    };
+
+    using row_t      =  lt::record<  entry< "n", no_default >,  entry< "s", std::string >  >;
+    using columns_t  =  lt::record_columns<  entry< "n", no_default >,  entry< "s", std::string >  >;
+
+
+    columns_t columns;
+
+    for ( int k = 0;  k != 100;  ++k )
+        columns.push_back(  row_t{  arg<"n">( no_default{ k } ),  arg<"s">( std::string( k, 'x' ) )  }  );
+
+    columns_t copy = columns;
+    columns.clear();
+
+    CHECK(  columns.empty()  );
+    CHECK(  copy.size() == 100  );
+    CHECK(  copy.column( "n"_index )[ 57 ].x == 57  );
+    CHECK(  copy[ 99 ][ "s"_index ].size() == 99  );
+
+
+    //  a row whose second value throws on copy leaves the columns aligned:
+
+    struct throws_on_copy
+    {
+        explicit throws_on_copy(  bool fail  )  :  fail( fail )  { }
+
+        throws_on_copy(  throws_on_copy const&  other  )
+        :   fail(  other.fail  )
+        {
+            if ( fail )
+                throw std::runtime_error( "copy" );
+        }
+
+        throws_on_copy(  throws_on_copy&&  )  =  default;
+
+        bool fail;
+    };
+
+    using guarded_row_t  =  lt::record<  entry< "n", int >,  entry< "t", throws_on_copy >  >;
+    using guarded_t      =  lt::record_columns<  entry< "n", int >,  entry< "t", throws_on_copy >  >;
+
+
+    guarded_row_t const  good{  arg<"n">( 1 ),  arg<"t">( throws_on_copy{ false } )  };
+    guarded_row_t const  bad{   arg<"n">( 2 ),  arg<"t">( throws_on_copy{ true } )   };
+
+    guarded_t guarded;
+
+    guarded.push_back( good );
+    CHECK_THROWS(  guarded.push_back( bad )  );
+    guarded.push_back( good );
+
+    CHECK(  guarded.size() == 2  );
+    CHECK(  guarded.column( "n"_index ).size() == 2  );
+    CHECK(  guarded[ 1 ][ "n"_index ] == 1  );
+}
+
+
+
+TEST_CASE("eval_batch")
+{
+    using row_t      =  lt::record<  entry< "x", double >,  entry< "y", int >,  fixed_entry< "add", std::plus<> >  >;
+    using columns_t  =  lt::record_columns<  entry< "x", double >,  entry< "y", int >,  fixed_entry< "add", std::plus<> >  >;
+
+    using program    =  lt::s_expr< "( add x ( add y y ) )" >;
+
+
+    std::vector< row_t >  rows;
+    columns_t             columns;
+
+    for ( int k = 0;  k != 100;  ++k )
+    {
+        row_t r{  arg<"x">( 0.5 * k ),  arg<"y">( k )  };
+
+        rows.push_back( r );
+        columns.push_back( r );
+    }
+
+
+    std::vector< double >  from_rows( 100 );
+    std::vector< double >  from_columns( 100 );
+
+    lt::eval_batch(  program{},  rows,     from_rows     );
+    lt::eval_batch(  program{},  columns,  from_columns  );
+
+    CHECK(  from_rows == from_columns  );
+    CHECK(  from_columns[ 10 ] == rows[ 10 ].eval( program{} )  );
+    CHECK(  from_columns[ 10 ] == 25  );
+}
+
+
+
+// -----------------------------------------------------------------------------
+//
+// Binary layout:
+//
+// -----------------------------------------------------------------------------
+
+
+TEST_CASE("binary_layout")
+{
+    using record_1  =  lt::record<  entry< "id", long >,  entry< "flag", bool >,  entry< "x", double >,  fixed_entry< "version", int >  >;
+    using record_2  =  lt::record<  entry< "x", double >,  entry< "id", long >,  entry< "flag", bool >  >;
+    using record_3  =  lt::record<  entry< "x", float >,  entry< "id", long >,  entry< "flag", bool >  >;
+
+    using layout_1  =  lt::binary_layout< record_1 >;
+
+
+    static_assert(  layout_1::offset( "flag"_index ) == 0  );
+    static_assert(  layout_1::offset( "id"_index )   == alignof(long)  );
+    static_assert(  layout_1::offset( "x"_index )    == alignof(long) + sizeof(long)  );
+    static_assert(  ! layout_1::stored( "version"_index )  );
+
+    static_assert(  layout_1::hash == lt::binary_layout< record_2 >::hash  );
+    static_assert(  layout_1::hash != lt::binary_layout< record_3 >::hash  );
+
+
+    record_1 r{  arg<"id">( 42L ),  arg<"flag">( true ),  arg<"x">( 2.5 )  };
+
+    std::vector< std::byte >  buffer(  layout_1::size + 1,  std::byte{ 0xff }  );
+
+    CHECK(  lt::write_to(  r,  std::span( buffer ).subspan( 1 )  )  ==  layout_1::size  );
+    CHECK(  buffer[ 1 + 1 ] == std::byte{ 0 }  );    // padding after "flag"
+
+
+    lt::record_view< record_2 >  view{  std::span< std::byte const >( buffer ).subspan( 1 )  };
+
+    CHECK(  view[ "id"_index ] == 42  );
+    CHECK(  view[ "x"_index ]  == 2.5  );
+    CHECK(  view.invoke(  []( double x,  long id,  bool flag ) {  return x == 2.5 && id == 42 && flag;  } )  );
+
+
+    record_2 copy = view;
+
+    CHECK(  copy[ "flag"_index ]  );
+    CHECK(  lt::record_view< record_1 >{  std::span< std::byte const >( buffer ).subspan( 1 )  }[ "version"_index ] == 0  );
+
+
+    std::vector< std::byte >  short_buffer(  layout_1::size - 1,  std::byte{ 0xff }  );
+
+    CHECK(  lt::write_to(  r,  std::span( short_buffer )  )  ==  0  );
+    CHECK(  short_buffer[ 0 ] == std::byte{ 0xff }  );
+}
+
+
+
+// -----------------------------------------------------------------------------
+//
+// Loading delimited text:
+//
+// -----------------------------------------------------------------------------
+
+
+TEST_CASE("record_loader")
+{
+    using columns_t  =  lt::record_columns<  entry< "price", double >
+                                          ,  entry< "qty", int >
+                                          ,  entry< "ok", bool >
+                                          ,  entry< "name", std::string >
+                                          ,  fixed_entry< "version", int >
+                                          >;
+
+    columns_t                       columns;
+    lt::record_loader< columns_t >  loader;
+
+    loader.read_header( "id,qty,price,version,ok,name\r" );
+
+
+    std::string_view const text = "1,5,2.5,9,true,abc\r\n2,7,1.25,9,0,de\n3,x,3,9,1,f";
+
+    std::size_t consumed = loader.load(  text.substr( 0, 24 ),  columns  );
+
+    CHECK(  consumed == 20  );
+    CHECK(  columns.size() == 1  );
+
+    consumed += loader.load(  text.substr( consumed ),  columns,  true  );
+
+    CHECK(  consumed == text.size()  );
+    CHECK(  columns.size() == 3  );
+    CHECK(  loader.rows() == 3  );
+    CHECK(  loader.errors() == 1  );    // "x" is not an int
+
+
+    CHECK(  columns[ 0 ].invoke(  []( double p,  int q,  bool ok,  std::string const& s,  int v ) {  return p == 2.5 && q == 5 && ok && s == "abc" && v == 0;  } )  );
+    CHECK(  columns[ 1 ].invoke(  []( double p,  int q,  bool ok,  std::string const& s,  int   ) {  return p == 1.25 && q == 7 && !ok && s == "de";  } )  );
+    CHECK(  columns[ 2 ].invoke(  []( double p,  int q,  bool ok,  std::string const& s,  int   ) {  return p == 3 && q == 0 && ok && s == "f";  } )  );
+
+
+    lt::record_loader< columns_t >  tsv( '\t' );
+
+    tsv.read_header( "qty\tprice" );
+    tsv.load(  "4\t0.5\n",  columns  );
+
+    CHECK(  columns[ 3 ][ "price"_index ] == 0.5  );
+}
+
+
+
+// -----------------------------------------------------------------------------
+//
+// Comparison and hashing:
+//
+// -----------------------------------------------------------------------------
+
+
+TEST_CASE("comparison and hashing")
+{
+    using key_t  =  lt::record<  entry< "a", int >,  fixed_entry< "f", int >,  entry< "s", std::string >  >;
+
+    key_t const x{  arg<"a">( 1 ),  arg<"s">( std::string( "x" ) )  };
+    key_t const y{  arg<"a">( 1 ),  arg<"s">( std::string( "y" ) )  };
+    key_t const z{  arg<"a">( 0 ),  arg<"s">( std::string( "z" ) )  };
+
+    CHECK(  x == key_t( x )  );
+    CHECK(  x != y  );
+    CHECK(  x <  y  );
+    CHECK(  z <  x  );
+    CHECK(  lt::record_hash{}( x ) == lt::record_hash{}( key_t( x ) )  );
+
+
+    using bytes_t  =  lt::record<  entry< "a", int >,  entry< "b", int >  >;
+
+    static_assert(  bytes_t{} == bytes_t{}  );
+    static_assert(  std::has_unique_object_representations_v< bytes_t >  );
+
+    CHECK(  lt::record_hash{}( bytes_t{ arg<"a">( 1 ),  arg<"b">( 2 ) } ) == lt::record_hash{}( bytes_t{ arg<"b">( 2 ),  arg<"a">( 1 ) } )  );
+    CHECK(  lt::record_hash{}( bytes_t{ arg<"a">( 1 ),  arg<"b">( 2 ) } ) != lt::record_hash{}( bytes_t{ arg<"a">( 2 ),  arg<"b">( 1 ) } )  );
+
+
+    std::unordered_set< key_t >  set;
+
+    set.insert( x );
+    set.insert( y );
+    set.insert( key_t( x ) );
+
+    CHECK(  set.size() == 2  );
+    CHECK(  set.contains( y )  );
+    CHECK(  ! set.contains( z )  );
+}
+
+
+
+// -----------------------------------------------------------------------------
+//
+// Concurrent records:
+//
+// -----------------------------------------------------------------------------
+
+
+TEST_CASE("concurrent_record")
+{
+    using record_t  =  lt::record<  entry< "x", long >,  entry< "y", long >,  entry< "z", char >,  fixed_entry< "f", int >  >;
+
+    lt::concurrent_record<  entry< "x", long >,  entry< "y", long >,  entry< "z", char >,  fixed_entry< "f", int >  >  shared;
+
+    CHECK(  shared.version() == 0  );
+    CHECK(  shared.snapshot() == record_t{}  );
+
+    shared.store(  record_t{  arg<"x">( 1L ),  arg<"y">( -1L ),  arg<"z">( 'z' )  }  );
+
+    CHECK(  shared.version() == 1  );
+    CHECK(  shared.load( "x"_index ) == 1  );
+    CHECK(  shared.load( "z"_index ) == 'z'  );
+    CHECK(  shared.load( "f"_index ) == 0  );
+    CHECK(  shared.snapshot() == record_t{  arg<"x">( 1L ),  arg<"y">( -1L ),  arg<"z">( 'z' )  }  );
+
+
+    //  x + y == 0 holds for every published record, hence for every snapshot
+
+    bool torn = false;
+
+    std::thread reader(  [&]
+    {
+        for ( int n = 0;  n != 100'000;  ++n )
+        {
+            auto const r = shared.snapshot();
+            torn = torn  ||  r[ "x"_index ] + r[ "y"_index ] != 0;
+        }
+    } );
+
+    for ( long n = 0;  n != 100'000;  ++n )
+        shared.store(  record_t{  arg<"x">( n ),  arg<"y">( -n ),  arg<"z">( 'z' )  }  );
+
+    reader.join();
+
+    CHECK(  ! torn  );
+    CHECK(  shared.load( "y"_index ) == -99'999  );
+}
+
+
+
+// -----------------------------------------------------------------------------
+//
+// Change tracking:
+//
+// -----------------------------------------------------------------------------
+
+
+TEST_CASE("tracked_record")
+{
+    using tracked_t  =  lt::tracked_record<  entry< "id", int >,  entry< "name", std::string >,  fixed_entry< "v", int >,  entry< "tags", std::vector< int > >  >;
+
+    static_assert(  tracked_t::index_of( "tags"_index ) == 3  );
+
+    tracked_t  x{  arg<"id">( 1 ),  arg<"name">( std::string( "x" ) ),  arg<"tags">( std::vector< int >{ 1, 2 } )  };
+
+    CHECK(  x.dirty().none()  );
+    CHECK(  x.values()[ "name"_index ] == "x"  );
+    CHECK(  std::as_const( x )[ "id"_index ] == 1  );
+    CHECK(  x.dirty().none()  );
+    CHECK(  x[ "v"_index ] == 0  );
+    CHECK(  x.dirty().none()  );
+
+    x[ "name"_index ] += "yz";
+    x[ "tags"_index ].push_back( 3 );
+
+    CHECK(  x.dirty().count() == 2  );
+    CHECK(  x.is_dirty( "name"_index )  );
+    CHECK(  ! x.is_dirty( "id"_index )  );
+
+
+    std::vector< std::string >  changed;
+
+    x.for_each_dirty(  [&]( auto k,  auto const& )  {  changed.push_back(  std::to_string( tracked_t::index_of( k ) )  );  } );
+
+    CHECK(  changed == std::vector< std::string >{ "1", "3" }  );
+
+
+    tracked_t  y{  arg<"id">( 2 ),  arg<"name">( std::string() ),  arg<"tags">( std::vector< int >() )  };
+
+    y.merge_dirty( x );
+
+    CHECK(  std::as_const( y )[ "id"_index ] == 2  );
+    CHECK(  y.values()[ "name"_index ] == "xyz"  );
+    CHECK(  y.values()[ "tags"_index ].size() == 3  );
+    CHECK(  y.dirty() == x.dirty()  );
+
+
+    using subset_t  =  lt::tracked_record<  entry< "tags", std::vector< int > >,  entry< "id", int >  >;
+
+    subset_t  z{  arg<"tags">( std::vector< int >{ 4 } ),  arg<"id">( 0 )  };
+
+    z[ "tags"_index ].push_back( 5 );
+    y.clear_dirty();
+    y.merge_dirty(  static_cast< subset_t&& >( z )  );
+
+    CHECK(  y.values()[ "tags"_index ] == std::vector< int >{ 4, 5 }  );
+    CHECK(  z.values()[ "tags"_index ].empty()  );
+    CHECK(  y.is_dirty( "tags"_index )  );
+    CHECK(  y.dirty().count() == 1  );
+}
+
+
+
+// -----------------------------------------------------------------------------
+//
+// Bit-packed entries:
+//
+// -----------------------------------------------------------------------------
+
+
+enum class phase : unsigned char {  idle,  running,  stopped  };
+
+
+
+TEST_CASE("packed entries")
+{
+    using lt::bit_entry;
+    using lt::packed_entry;
+
+    using flags_t  =  lt::record<  bit_entry< "a" >,  bit_entry< "b" >,  bit_entry< "c" >,  bit_entry< "d" >
+                                ,  bit_entry< "e" >,  bit_entry< "f" >,  bit_entry< "g" >,  bit_entry< "h" >
+                                >;
+
+    static_assert(  sizeof( flags_t ) == 1  );
+
+
+    using task_t  =  lt::record<  bit_entry< "active" >,  entry< "id", int >,  packed_entry< "phase", phase, 2 >,  bit_entry< "dirty" >  >;
+
+    task_t  t{  arg<"active">( true ),  arg<"id">( 7 ),  arg<"phase">( phase::running ),  arg<"dirty">( false )  };
+
+    CHECK(  t[ "active"_index ]  );
+    CHECK(  ! t[ "dirty"_index ]  );
+    CHECK(  t[ "phase"_index ] == phase::running  );
+    CHECK(  t[ "id"_index ] == 7  );
+
+    t[ "dirty"_index ] = true;
+    t[ "phase"_index ] = phase::stopped;
+    t[ "active"_index ] = t[ "dirty"_index ];
+
+    CHECK(  t.invoke(  []( bool active,  int id,  phase p,  bool dirty ) {  return active && id == 7 && p == phase::stopped && dirty;  }  )  );
+
+
+    task_t  u;
+
+    CHECK(  ! u[ "active"_index ]  );
+    CHECK(  u[ "phase"_index ] == phase::idle  );
+    CHECK(  u != t  );
+    CHECK(  u <  t  );
+
+    u <<= t;
+
+    CHECK(  u == t  );
+    CHECK(  lt::record_hash{}( u ) == lt::record_hash{}( t )  );
+
+
+    using subset_t  =  lt::record<  entry< "id", int >,  packed_entry< "phase", phase, 2 >  >;
+
+    u <<= subset_t{  arg<"id">( 1 ),  arg<"phase">( phase::idle )  };
+
+    CHECK(  u[ "id"_index ] == 1  );
+    CHECK(  u[ "phase"_index ] == phase::idle  );
+    CHECK(  u[ "dirty"_index ]  );
+
+
+    using wide_t  =  lt::record<  packed_entry< "x", unsigned, 30 >,  packed_entry< "y", unsigned, 30 >,  packed_entry< "z", unsigned, 30 >  >;
+
+    static_assert(  sizeof( wide_t ) == 16  );
+
+    wide_t  w{  arg<"x">( 1u << 29 ),  arg<"y">( 12345u ),  arg<"z">( ( 1u << 30 ) - 1 )  };
+
+    CHECK(  w[ "x"_index ] == 1u << 29  );
+    CHECK(  w[ "y"_index ] == 12345u  );
+    CHECK(  w[ "z"_index ] == ( 1u << 30 ) - 1  );
+
+
+    enum class offset : signed char {  back = -2,  none = 0,  ahead = 1  };
+
+    using signed_t  =  lt::record<  packed_entry< "d", int, 4 >,  packed_entry< "o", offset, 2 >,  packed_entry< "u", unsigned, 4 >  >;
+
+    signed_t  s{  arg<"d">( -1 ),  arg<"o">( offset::back ),  arg<"u">( 15u )  };
+
+    CHECK(  s[ "d"_index ] == -1  );
+    CHECK(  s[ "o"_index ] == offset::back  );
+    CHECK(  s[ "u"_index ] == 15u  );
+
+    s[ "d"_index ] = -8;
+    s[ "o"_index ] = offset::ahead;
+
+    CHECK(  s[ "d"_index ] == -8  );
+    CHECK(  s[ "o"_index ] == offset::ahead  );
+    CHECK(  s[ "u"_index ] == 15u  );
+
+
+    static_assert(  ! lt::without_packed_entries<  entry< "id", int >,  bit_entry< "a" >  >  );
+    static_assert(  lt::without_packed_entries<  entry< "id", int >,  fixed_entry< "e", int >  >  );
+}
+
+
+
+TEST_CASE("key names")
+{
+    using point_t  =  lt::record<  entry< "x", int >,  fixed_entry< "origin", int >,  entry< "label", std::string >  >;
+
+    constexpr auto const&  names  =  point_t::key_names();
+
+    static_assert(  names.size() == 3  );
+    static_assert(  names[ 0 ] == "x"  &&  names[ 1 ] == "origin"  &&  names[ 2 ] == "label"  );
+
+    CHECK(  &point_t::key_names() == &names  );
+    CHECK(  names[ 2 ].data() == lt::to_string_view<  decltype( "label"_text )  >.data()  );
+    CHECK(  lt::record<>::key_names().empty()  );
+}
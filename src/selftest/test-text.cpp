@@ -12,6 +12,7 @@
 #include "lt/selftest/selftest.hpp"
 
 #include "lt/text.hpp"
+#include "lt/perfect_hash.hpp"
 
 
 
@@ -100,3 +101,60 @@ TEST_CASE("user constructed literals" )
     static constexpr auto is_constexpr = "hello"_another_text;
     static_cast<void>(is_constexpr);
 }
+
+
+
+
+// ================================================================================================
+//
+//  perfect_hash:  ids of text keys without collisions
+//
+// ------------------------------------------------------------------------------------------------
+
+TEST_CASE("perfect hash")
+{
+    using lt::operator ""_text;
+
+    using commands  =  lt::perfect_hash<  decltype( "add"_text ),     decltype( "commit"_text ),  decltype( "push"_text )
+                                       ,  decltype( "pull"_text ),    decltype( "fetch"_text ),   decltype( "merge"_text )
+                                       ,  decltype( "rebase"_text ),  decltype( "log"_text ),     decltype( "status"_text )
+                                       ,  decltype( "diff"_text ),    decltype( ""_text ),        decltype( "a"_text )
+                                       >;
+
+    static_assert(  commands::size == 12  );
+    static_assert(  commands::find( "rebase"_text ) == 6  );
+    static_assert(  commands::find( "blame" ) == commands::size  );
+
+    char const* const  names[]  =  {  "add",  "commit",  "push",  "pull",  "fetch",  "merge",  "rebase",  "log",  "status",  "diff",  "",  "a"  };
+
+    for ( std::size_t k = 0;  k != commands::size;  ++k )
+    {
+        CHECK(  commands::find( names[ k ] ) == k  );
+        CHECK(  commands::key( k ) == names[ k ]  );
+    }
+
+    CHECK(  commands::find( "ad" )      == commands::size  );
+    CHECK(  commands::find( "adds" )    == commands::size  );
+    CHECK(  commands::find( "status!" ) == commands::size  );
+
+
+    using none  =  lt::perfect_hash<>;
+
+    static_assert(  none::find( "x" ) == 0  );
+}
+
+
+
+TEST_CASE("to_string_view")
+{
+    using lt::operator ""_text;
+
+    static_assert(  lt::to_string_view<  decltype( "commit"_text )  > == "commit"  );
+    static_assert(  lt::to_string_view<  decltype( ""_text )  >.empty()  );
+
+    constexpr std::string_view  s  =  lt::to_string_view<  decltype( "key"_text )  >;
+
+    CHECK(  s.size() == 3  );
+    CHECK(  s.data()[ 3 ] == '\0'  );
+    CHECK(  s.data() == lt::to_string_view<  decltype( "key"_text )  >.data()  );
+}
@@ -436,6 +436,106 @@ TEST_CASE("*const_volatile")
 
 
 
+// -----------------------------------------------------------------------------
+//
+// Type Patterns:
+//
+// -----------------------------------------------------------------------------
+
+
+TEST_CASE("type patterns")
+{
+    using expr_1  =  lt::lib::ts::metaprogram< "[x]( type_matches_pattern '(*) (cpp_to_lisp x) )",  x*  >;
+    using Expr_1  =  lt::value<true>;
+
+    lt::selftest::check_expression_equality<  expr_1,  Expr_1  >("expr_1: ");
+
+
+
+    using expr_2  =  lt::lib::ts::metaprogram< "[x]( type_matches_pattern '(&) (cpp_to_lisp x) )",  x*  >;
+    using Expr_2  =  lt::value<false>;
+
+    lt::selftest::check_expression_equality<  expr_2,  Expr_2  >("expr_2: ");
+
+
+
+    using expr_3  =
+    lt::lib::ts::metaprogram<
+        "[x]( lisp_to_cpp ( apply_type_pattern '(const) ( drop_type_pattern '(*) (cpp_to_lisp x) ) ) )"
+    ,   x*
+    >;
+
+    using Expr_3  =  x const;
+
+    lt::selftest::check_expression_equality<  expr_3,  Expr_3  >("expr_3: ");
+
+
+
+    using expr_4  =
+    lt::lib::ts::metaprogram<
+        R"( [f]
+            (   import  ( match  '( function ( signature ?R ?Args... ) ?qualifiers... )  ( cpp_to_lisp f )  )
+                        ( list  R  ( count Args )  qualifiers )
+            )
+        )"
+    ,   x (y, y) const& noexcept
+    >;
+
+    using Expr_4  =  lt::s<  x
+                          ,  lt::value<2>
+                          ,  lt::s<  lt::value_type<"const&"_text>,  lt::value_type<"noexcept"_text>  >
+                          >;
+
+    lt::selftest::check_expression_equality<  expr_4,  Expr_4  >("expr_4: ");
+}
+
+
+
+TEST_CASE("template argument lists")
+{
+    struct alignas(4) z {};
+
+    using variant_x_y_z  =  f<  x,  f<  y,  f< z,  x >  >,  z,  f<>  >;
+
+
+    using expr_1  =  lt::lib::ts::metaprogram< "[t]( flatten_template t )",  variant_x_y_z  >;
+    using Expr_1  =  f<  x,  y,  z,  x,  z  >;
+
+    lt::selftest::check_expression_equality<  expr_1,  Expr_1  >("expr_1: ");
+
+
+
+    using expr_2  =  lt::lib::ts::metaprogram< "[t]( unique_types ( flatten_template t ) )",  variant_x_y_z  >;
+    using Expr_2  =  f<  x,  y,  z  >;
+
+    lt::selftest::check_expression_equality<  expr_2,  Expr_2  >("expr_2: ");
+
+
+
+    using expr_3  =
+    lt::lib::ts::metaprogram< "[t]( sort_types_by alignof ( unique_types ( flatten_template t ) ) )",  variant_x_y_z  >;
+
+    using Expr_3  =  f<  z,  x,  y  >;
+
+    lt::selftest::check_expression_equality<  expr_3,  Expr_3  >("expr_3: ");
+
+
+
+    using expr_4  =
+    lt::lib::ts::metaprogram< "[t]( lisp_to_cpp ( unique_types ( flatten_template ( cpp_to_lisp t ) ) ) )",  variant_x_y_z  >;
+
+    using Expr_4  =  f<  x,  y,  z  >;
+
+    lt::selftest::check_expression_equality<  expr_4,  Expr_4  >("expr_4: ");
+
+
+
+    using expr_5  =  lt::lib::ts::metaprogram< "[t]( eval_success ( flatten_template t ) )",  x  >;
+    using Expr_5  =  lt::value<false>;
+
+    lt::selftest::check_expression_equality<  expr_5,  Expr_5  >("expr_5: ");
+}
+
 
 
 
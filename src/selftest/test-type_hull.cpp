@@ -29,6 +29,24 @@ lt::selftest::configuration_space<  n
 
 
 
+//  configurations are numbered with the first position varying fastest,  slices and
+//  random access agree with list:
+
+using type_hull_test_space  =  lt::selftest::configuration_space<  2,  void,  int,  int (double) const&  >;
+
+static_assert(  type_hull_test_space::size == 9  );
+
+static_assert(  std::is_same_v<  type_hull_test_space::at<5>,  lt::selftest::pack<  int (double) const&,  int  >  >  );
+
+static_assert(  std::is_same_v<  type_hull_test_space::slice< 3, 5 >
+                              ,  std::tuple<  std::tuple_element_t<  3,  type_hull_test_configurations<2>  >
+                                           ,  std::tuple_element_t<  4,  type_hull_test_configurations<2>  >
+                                           >
+                              >
+             );
+
+
+
 
 // -----------------------------------------------------------------------------
 //
@@ -0,0 +1,28 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Uses the header that trivium-eval generates from example.lisp (make example):  the
+//  translation unit includes the result instead of evaluating the program with lt::eval.
+
+
+#include "example.hpp"
+
+#include <type_traits>
+
+
+
+static_assert(  std::is_same_v<  example
+                              ,  lt::packed<  2,  3,  5,  7,  11,  13,  17,  19,  23,  29,  31,  37,  41
+                                           ,  43,  47,  53,  59,  61,  67,  71,  73,  79,  83,  89,  97
+                                           >
+                              >
+             );
+
+
+
+int main() {}
@@ -0,0 +1,21 @@
+;  The first primes up to 100 as a packed list,  evaluated by trivium-eval:
+;
+;      lt::packed< 2, 3, 5, 7, 11, ... >
+
+{
+    (   def 'prime [n k]
+        (   if  ( > ( * k k ) n )
+            true
+            ( if ( == ( % n k ) 0 ) false ( prime n ( + k 1 ) ) )
+        )
+    )
+
+    (   def 'primes [n acc]
+        (   if  ( == n 1 )
+            ( pack acc )
+            ( primes ( - n 1 ) ( if ( prime n 2 ) ( cons n acc ) acc ) )
+        )
+    )
+
+    ( primes 100 () )
+}
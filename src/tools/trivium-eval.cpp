@@ -0,0 +1,268 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+//  trivium-eval:  evaluates a constant Trivium Lisp program at build time.
+//
+//      trivium-eval  program.lisp  name  header.hpp  [ argument ... ]
+//
+//  writes header.hpp with
+//
+//      using name = < the type of lt::eval< program > >;
+//
+//  With arguments,  the program is applied to them as by lt::metaprogram,  each argument
+//  being the source of an s-expression,  e.g.  trivium-eval sum.lisp sum sum.hpp "#( 1 2 3 )".
+//  A name with a scope  ns::name  is declared in namespace ns.
+//
+//  header.hpp records a hash of the program, the name, the arguments and the interpreter
+//  version TRIVIUM_EVAL_VERSION.  If the header exists with the same hash,  trivium-eval neither evaluates the program nor writes the
+//  header,  hence the header keeps its time stamp and its dependants are not rebuilt.
+//
+//  Exit codes:  0  success,  1  usage or i/o error,  2  the program is ill-formed
+//  (it would not compile with lt::eval),  3  the evaluation results in an error.
+
+
+#include "lt/host_eval.hpp"
+
+#include <pthread.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+
+//  The build passes a hash of trivium-eval.cpp and lt/host_eval.hpp (see Makefile),
+//  so a changed interpreter rewrites every header.  Without it,  the time of the build
+//  stands in for the version.
+
+#ifndef TRIVIUM_EVAL_VERSION
+#define TRIVIUM_EVAL_VERSION  __DATE__ " " __TIME__
+#endif
+
+
+
+namespace
+{
+    constexpr std::size_t  stack_size  =  std::size_t( 1 ) << 30;      //  the interpreter recurses
+
+
+
+    std::uint64_t fnv1a_64(  std::string const&  s  )
+    {
+        std::uint64_t  h  =  14695981039346656037ull;
+
+        for ( char const  c : s )
+            h = ( h ^ static_cast< unsigned char >( c ) ) * 1099511628211ull;
+
+        return h;
+    }
+
+
+
+    std::string hash_line(  std::uint64_t  h  )
+    {
+        char  line[ 64 ];
+
+        std::snprintf(  line,  sizeof line,  "//  source hash:  %016llx",  static_cast< unsigned long long >( h )  );
+
+        return line;
+    }
+
+
+
+    bool read_file(  char const*  path,  std::string&  content  )
+    {
+        std::ifstream  in(  path,  std::ios::binary  );
+
+        if ( ! in )
+            return false;
+
+        std::ostringstream  s;
+        s << in.rdbuf();
+        content = s.str();
+
+        return true;
+    }
+
+
+
+    struct job
+    {
+        lt::host::term                 program;
+        std::vector< lt::host::term >  arguments;
+        lt::host::term                 result;
+        std::string                    failure;
+    };
+
+
+
+    void* run(  void*  p  )
+    {
+        job&  j  =  *static_cast< job* >( p );
+
+        try
+        {
+            lt::host::term  x  =  j.program;
+
+            if ( ! j.arguments.empty() )             //  lt::metaprogram< program, X... >
+            {
+                std::vector< lt::host::term >  xs {  x  };
+
+                for ( lt::host::term const&  a : j.arguments )
+                    xs.push_back(  lt::host::make(  lt::host::kind::quoted,  {  a  }  )  );
+
+                x = lt::host::make(  lt::host::kind::s,  std::move( xs )  );
+            }
+
+            j.result = lt::host::evaluate( x );
+        }
+        catch ( std::exception const&  e )
+        {
+            j.failure = e.what();
+        }
+
+        return nullptr;
+    }
+
+
+
+    bool evaluate_with_large_stack(  job&  j  )
+    {
+        pthread_attr_t  attr;
+        pthread_t       thread;
+
+        if (  pthread_attr_init( &attr ) != 0  )
+            return false;
+
+        bool const  started  =  pthread_attr_setstacksize( &attr,  stack_size ) == 0
+                            &&  pthread_create( &thread,  &attr,  run,  &j ) == 0;
+
+        pthread_attr_destroy( &attr );
+
+        if ( started )
+            pthread_join(  thread,  nullptr  );
+
+        return started;
+    }
+}
+
+
+
+int main(  int  argc,  char**  argv  )
+{
+    if ( argc < 4 )
+    {
+        std::cerr << "usage:  trivium-eval  program.lisp  name  header.hpp  [ argument ... ]\n";
+        return 1;
+    }
+
+    std::string  source;
+
+    if ( ! read_file(  argv[ 1 ],  source  ) )
+    {
+        std::cerr << "trivium-eval:  cannot read " << argv[ 1 ] << "\n";
+        return 1;
+    }
+
+    std::string const  name  =  argv[ 2 ];
+    std::string        key   =  TRIVIUM_EVAL_VERSION + ( '\0' + source ) + '\0' + name;
+
+    for ( int k = 4;  k < argc;  ++k )
+        key += '\0' + std::string( argv[ k ] );
+
+    std::string const  hash  =  hash_line(  fnv1a_64( key )  );
+
+
+    //  an up-to-date header is left untouched:
+
+    std::string  old_header;
+
+    if ( read_file(  argv[ 3 ],  old_header  )  &&  old_header.find( hash + "\n" ) != std::string::npos )
+        return 0;
+
+
+    job  j;
+
+    try
+    {
+        j.program = lt::host::program( source );
+
+        for ( int k = 4;  k < argc;  ++k )
+            j.arguments.push_back(  lt::host::program( argv[ k ] )  );
+    }
+    catch ( lt::host::error const&  e )
+    {
+        std::cerr << argv[ 1 ] << ":  ill-formed program:  " << e.what() << "\n";
+        return 2;
+    }
+
+    if ( ! evaluate_with_large_stack( j ) )
+    {
+        std::cerr << "trivium-eval:  cannot start the evaluation thread\n";
+        return 1;
+    }
+
+    if ( ! j.failure.empty() )
+    {
+        std::cerr << argv[ 1 ] << ":  ill-formed program:  " << j.failure << "\n";
+        return 2;
+    }
+
+    if ( j.result->k == lt::host::kind::error )
+    {
+        std::cerr << argv[ 1 ] << ":  evaluation error:  " << lt::host::cpp_type(  j.result,  true  ) << "\n";
+        return 3;
+    }
+
+    std::string  type;
+
+    try
+    {
+        type = lt::host::cpp_type( j.result );
+    }
+    catch ( lt::host::error const&  e )
+    {
+        std::cerr << argv[ 1 ] << ":  " << e.what() << "\n";
+        return 3;
+    }
+
+
+    std::size_t const  scope  =  name.rfind( "::" );
+
+    std::ostringstream  header;
+
+    header  <<  "//  Generated by trivium-eval from " << argv[ 1 ] << ",  do not edit.\n"
+            <<  hash << "\n"
+            <<  "\n"
+            <<  "#pragma once\n"
+            <<  "\n"
+            <<  "#include \"lt/" << (  lt::host::uses_eval_hpp( j.result )  ?  "eval.hpp"  :  "s_types.hpp"  ) << "\"\n"
+            <<  "\n\n\n";
+
+    if ( scope == std::string::npos )
+        header  <<  "using " << name << "  =  " << type << ";\n";
+    else
+        header  <<  "namespace " << name.substr( 0, scope ) << "\n"
+                <<  "{\n"
+                <<  "    using " << name.substr( scope + 2 ) << "  =  " << type << ";\n"
+                <<  "}\n";
+
+    std::ofstream  out(  argv[ 3 ],  std::ios::binary  );
+
+    if ( ! ( out << header.str() ) )
+    {
+        std::cerr << "trivium-eval:  cannot write " << argv[ 3 ] << "\n";
+        return 1;
+    }
+
+    return 0;
+}
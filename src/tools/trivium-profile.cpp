@@ -0,0 +1,542 @@
+/////////////////////////////////////////////////////////////////////////////////////////////
+// Copyright 2023-2024 Andreas Milton Maniotis.//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Email: andreas.maniotis@gmail.com
+/////////////////////////////////////////////////////////////////////////////////////////////
+
+//  trivium-profile:  a flat profile of the Trivium Lisp definitions from clang time traces.
+//
+//      trivium-profile  trace.json  [ trace.json ... ]
+//
+//  Compile the translation units with
+//
+//      clang++ -DTRIVIUM_TRACE_DEFS -ftime-trace -ftime-trace-granularity=0 ...
+//
+//  With TRIVIUM_TRACE_DEFS,  lt/eval.hpp evaluates each call of a named definition f inside
+//  of an instantiation of  lt::i<>::traced_def< text< f... > >::evaluation< ... >.  For each
+//  definition,  trivium-profile reports
+//
+//      self     the time of its events without the time of the traced calls within them,
+//      total    the time of its outermost events,  i.e. a call within a call of the same
+//               definition is not counted twice,
+//      count    the number of its events (instantiations are memoized by the compiler:
+//               a call with the same arguments in the same environment is counted once),
+//      depth    the maximal depth of its traced calls,  a call outside of any traced call
+//               being at depth 1.
+//
+//  Exit codes:  0  success,  1  usage or i/o error,  2  a trace is malformed.
+
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+
+namespace
+{
+    struct malformed : std::runtime_error
+    {
+        using std::runtime_error::runtime_error;
+    };
+
+
+
+    struct event
+    {
+        std::string  definition;
+        long long    tid;
+        double       begin;             //  microseconds
+        double       end;
+    };
+
+
+
+    //  A reader for the subset of JSON in a time trace:  it keeps the fields name, ph, tid,
+    //  ts, dur and args.detail of the objects in the array traceEvents and skips the rest.
+
+    class trace_reader
+    {
+    public:
+
+        explicit trace_reader(  std::string_view  text  )
+        :   text_( text )
+        { }
+
+
+
+        template<  typename Sink  >
+        void events(  Sink&&  sink  )
+        {
+            expect_( '{' );
+
+            if ( accept_( '}' ) )
+                return;
+
+            do
+            {
+                std::string const  key  =  string_();
+                expect_( ':' );
+
+                if ( key != "traceEvents" )
+                {
+                    skip_();
+                    continue;
+                }
+
+                expect_( '[' );
+
+                if ( accept_( ']' ) )
+                    continue;
+
+                do
+                    sink(  object_()  );
+                while ( accept_( ',' ) );
+
+                expect_( ']' );
+            }
+            while ( accept_( ',' ) );
+
+            expect_( '}' );
+        }
+
+
+
+        struct fields
+        {
+            std::string  name,  ph,  detail;
+            double       tid  =  0,  ts  =  0,  dur  =  0;
+        };
+
+
+    private:
+
+        std::string_view  text_;
+        std::size_t       pos_  =  0;
+
+
+
+        void whitespace_()
+        {
+            while (  pos_ < text_.size()  &&  std::string_view( " \t\r\n" ).find( text_[ pos_ ] ) != std::string_view::npos  )
+                ++pos_;
+        }
+
+
+
+        bool accept_(  char  c  )
+        {
+            whitespace_();
+
+            if (  pos_ < text_.size()  &&  text_[ pos_ ] == c  )
+            {
+                ++pos_;
+                return true;
+            }
+
+            return false;
+        }
+
+
+
+        void expect_(  char  c  )
+        {
+            if ( ! accept_( c ) )
+                throw malformed(  std::string( "expected '" ) + c + "' at offset " + std::to_string( pos_ )  );
+        }
+
+
+
+        std::string string_()
+        {
+            expect_( '"' );
+
+            std::string  s;
+
+            while ( pos_ < text_.size()  &&  text_[ pos_ ] != '"' )
+            {
+                char  c  =  text_[ pos_++ ];
+
+                if ( c == '\\' )
+                {
+                    if ( pos_ == text_.size() )
+                        break;
+
+                    c = text_[ pos_++ ];
+
+                    switch ( c )
+                    {
+                    case 'n':   c = '\n';   break;
+                    case 't':   c = '\t';   break;
+                    case 'r':   c = '\r';   break;
+                    case 'b':   c = '\b';   break;
+                    case 'f':   c = '\f';   break;
+                    case 'u':                               //  only ASCII is of interest
+                        {
+                            unsigned long const  u  =  std::stoul(  std::string( text_.substr( pos_,  4 ) ),  nullptr,  16  );
+
+                            pos_ += 4;
+                            c = u < 128  ?  static_cast< char >( u )  :  '?';
+                        }
+                        break;
+                    default:    break;                      //  \"  \\  \/
+                    }
+                }
+
+                s += c;
+            }
+
+            expect_( '"' );
+
+            return s;
+        }
+
+
+
+        double number_()
+        {
+            whitespace_();
+
+            std::size_t const  begin  =  pos_;
+
+            while (  pos_ < text_.size()  &&  std::string_view( "+-.eE0123456789" ).find( text_[ pos_ ] ) != std::string_view::npos  )
+                ++pos_;
+
+            if ( begin == pos_ )
+                throw malformed(  "expected a number at offset " + std::to_string( pos_ )  );
+
+            return std::stod(  std::string( text_.substr( begin,  pos_ - begin ) )  );
+        }
+
+
+
+        void skip_()
+        {
+            whitespace_();
+
+            if ( pos_ == text_.size() )
+                throw malformed( "unexpected end of the trace" );
+
+            switch ( text_[ pos_ ] )
+            {
+            case '"':
+                string_();
+                return;
+
+            case '{':
+                ++pos_;
+
+                if ( accept_( '}' ) )
+                    return;
+
+                do
+                {
+                    string_();
+                    expect_( ':' );
+                    skip_();
+                }
+                while ( accept_( ',' ) );
+
+                expect_( '}' );
+                return;
+
+            case '[':
+                ++pos_;
+
+                if ( accept_( ']' ) )
+                    return;
+
+                do
+                    skip_();
+                while ( accept_( ',' ) );
+
+                expect_( ']' );
+                return;
+
+            default:
+                if (  std::isalpha( static_cast< unsigned char >( text_[ pos_ ] ) )  )
+                {
+                    while (  pos_ < text_.size()  &&  std::isalpha( static_cast< unsigned char >( text_[ pos_ ] ) )  )
+                        ++pos_;                             //  true,  false,  null
+                    return;
+                }
+
+                number_();
+            }
+        }
+
+
+
+        fields object_()
+        {
+            fields  f;
+
+            expect_( '{' );
+
+            if ( accept_( '}' ) )
+                return f;
+
+            do
+            {
+                std::string const  key  =  string_();
+                expect_( ':' );
+
+                if      ( key == "name" )   f.name = string_();
+                else if ( key == "ph" )     f.ph   = string_();
+                else if ( key == "tid" )    f.tid  = number_();
+                else if ( key == "ts" )     f.ts   = number_();
+                else if ( key == "dur" )    f.dur  = number_();
+                else if ( key == "args" )
+                {
+                    expect_( '{' );
+
+                    if ( accept_( '}' ) )
+                        continue;
+
+                    do
+                    {
+                        std::string const  arg  =  string_();
+                        expect_( ':' );
+
+                        if ( arg == "detail" )
+                            f.detail = string_();
+                        else
+                            skip_();
+                    }
+                    while ( accept_( ',' ) );
+
+                    expect_( '}' );
+                }
+                else
+                    skip_();
+            }
+            while ( accept_( ',' ) );
+
+            expect_( '}' );
+
+            return f;
+        }
+    };
+
+
+
+    //  The definition in  "lt::i<>::traced_def<lt::t<'s', 'u', 'm'>>::evaluation<...>",
+    //  or the empty string for other events.  Characters that clang does not print as
+    //  character literals appear as integers.
+
+    std::string definition_of(  std::string const&  detail  )
+    {
+        static constexpr std::string_view  marker  =  "traced_def<";
+
+        std::size_t  pos  =  detail.find( marker );
+
+        if ( pos == std::string::npos )
+            return {};
+
+        pos = detail.find(  '<',  pos + marker.size()  );
+
+        if ( pos == std::string::npos )
+            return {};
+
+        std::string  name;
+
+        for ( ++pos;  pos < detail.size()  &&  detail[ pos ] != '>';  ++pos )
+        {
+            char const  c  =  detail[ pos ];
+
+            if ( c == '\'' )
+            {
+                char  x  =  detail[ ++pos ];
+
+                if ( x == '\\' )
+                {
+                    x = detail[ ++pos ];
+                    x = x == 'n' ? '\n'  :  x == 't' ? '\t'  :  x;
+                }
+
+                name += x;
+
+                ++pos;                                      //  the closing quote
+            }
+            else if (  std::isdigit( static_cast< unsigned char >( c ) )  ||  c == '-'  )
+            {
+                std::size_t  n  =  0;
+
+                name += static_cast< char >(  std::stoi(  detail.substr( pos ),  &n  )  );
+
+                pos += n - 1;
+            }
+        }
+
+        return name.empty()  ?  std::string( "<anonymous>" )  :  name;
+    }
+
+
+
+    bool read_file(  char const*  path,  std::string&  content  )
+    {
+        std::ifstream  in(  path,  std::ios::binary  );
+
+        if ( ! in )
+            return false;
+
+        std::ostringstream  s;
+        s << in.rdbuf();
+        content = s.str();
+
+        return true;
+    }
+
+
+
+    struct profile
+    {
+        double     self   =  0;
+        double     total  =  0;
+        unsigned   count  =  0;
+        unsigned   depth  =  0;
+    };
+
+
+
+    //  Adds the events of one trace.  Events of different threads or traces do not nest.
+
+    void fold(  std::vector< event >  events,  std::map< std::string, profile >&  result  )
+    {
+        std::sort(  events.begin(),  events.end()
+                 ,  []( event const&  a,  event const&  b )
+                    {
+                        if ( a.tid != b.tid )
+                            return a.tid < b.tid;
+
+                        if ( a.begin != b.begin )
+                            return a.begin < b.begin;
+
+                        return a.end > b.end;               //  the enclosing event first
+                    }
+                 );
+
+        struct open_event
+        {
+            event const*  e;
+            profile*      p;
+        };
+
+        std::vector< open_event >          stack;
+        std::map< std::string, unsigned >  open;            //  open events per definition
+
+        auto  close  =  [&]()
+        {
+            open_event const  top  =  stack.back();
+
+            stack.pop_back();
+
+            if ( --open[ top.e->definition ] == 0 )
+                top.p->total += top.e->end - top.e->begin;
+        };
+
+        for ( std::size_t k = 0;  k < events.size();  ++k )
+        {
+            event const&  e  =  events[ k ];
+
+            while (  ! stack.empty()  &&  (  stack.back().e->tid != e.tid  ||  stack.back().e->end <= e.begin  )  )
+                close();
+
+            profile&  p  =  result[ e.definition ];
+
+            p.self  +=  e.end - e.begin;
+            p.count +=  1;
+            p.depth  =  std::max(  p.depth,  static_cast< unsigned >( stack.size() + 1 )  );
+
+            if ( ! stack.empty() )
+                stack.back().p->self -= e.end - e.begin;
+
+            ++open[ e.definition ];
+            stack.push_back(  {  &e,  &p  }  );
+        }
+
+        while ( ! stack.empty() )
+            close();
+    }
+}
+
+
+
+int main(  int  argc,  char**  argv  )
+{
+    if ( argc < 2 )
+    {
+        std::cerr << "usage:  trivium-profile  trace.json  [ trace.json ... ]\n";
+        return 1;
+    }
+
+    std::map< std::string, profile >  result;
+
+    for ( int k = 1;  k < argc;  ++k )
+    {
+        std::string  trace;
+
+        if ( ! read_file(  argv[ k ],  trace  ) )
+        {
+            std::cerr << "trivium-profile:  cannot read " << argv[ k ] << "\n";
+            return 1;
+        }
+
+        std::vector< event >  events;
+
+        try
+        {
+            trace_reader(  trace  ).events(
+                [&](  trace_reader::fields const&  f  )
+                {
+                    if ( f.ph != "X" )
+                        return;
+
+                    std::string  definition  =  definition_of(  f.detail  );
+
+                    if ( ! definition.empty() )
+                        events.push_back(  {  std::move( definition ),  static_cast< long long >( f.tid ),  f.ts,  f.ts + f.dur  }  );
+                }
+            );
+        }
+        catch ( std::exception const&  e )
+        {
+            std::cerr << argv[ k ] << ":  malformed time trace:  " << e.what() << "\n";
+            return 2;
+        }
+
+        fold(  std::move( events ),  result  );
+    }
+
+    if ( result.empty() )
+    {
+        std::cerr << "trivium-profile:  no traced definitions (compile with -DTRIVIUM_TRACE_DEFS -ftime-trace)\n";
+        return 0;
+    }
+
+    std::vector< std::pair< std::string, profile > >  rows(  result.begin(),  result.end()  );
+
+    std::sort(  rows.begin(),  rows.end()
+             ,  []( auto const&  a,  auto const&  b )
+                {
+                    return  a.second.self != b.second.self  ?  a.second.self > b.second.self  :  a.first < b.first;
+                }
+             );
+
+    std::printf(  "%12s  %12s  %8s  %6s  %s\n",  "self [ms]",  "total [ms]",  "count",  "depth",  "definition"  );
+
+    for ( auto const&  [ name,  p ] : rows )
+        std::printf(  "%12.3f  %12.3f  %8u  %6u  %s\n",  p.self / 1000,  p.total / 1000,  p.count,  p.depth,  name.c_str()  );
+
+    return 0;
+}